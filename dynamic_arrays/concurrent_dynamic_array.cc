@@ -0,0 +1,257 @@
+/**
+ * @file concurrent_dynamic_array.cc
+ * @brief Lock-free append-only segmented Dynamic Array for many producers
+ *
+ * DynamicArray::append in dynamic_arrays1.cc moves every element on resize,
+ * so another thread could be reading the old buffer while it is freed. This
+ * array never moves an element once written:
+ *
+ *   segment 0: [ 0 ]                    capacity 1  (x kFirst)
+ *   segment 1: [ 1  2 ]                 capacity 2  (x kFirst)
+ *   segment 2: [ 3  4  5  6 ]           capacity 4  (x kFirst)
+ *   segment s: 2^s * kFirst slots, allocated on first use, never moved
+ *
+ * Key Concepts:
+ * - Writers claim a slot with one atomic fetch_add on reserved_
+ * - The slot index maps to (segment, offset) with a bit scan: O(1)
+ * - A missing segment is installed with compare_exchange; losers free theirs
+ * - Each slot has a ready flag; the published size() is the longest prefix of
+ *   ready slots, advanced by whichever writer completes it (no waiting)
+ * - Readers never lock: get(i) for i < size() sees a fully written element
+ *
+ * Time Complexities:
+ * - append(): O(1) amortized, lock-free (segment allocation is rare)
+ * - get():    O(1)
+ * - size():   O(1)
+ *
+ * Space Complexity: O(n) - at most 2x the elements, plus one flag per slot
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+using namespace std;
+
+/**
+ * @class ConcurrentDynamicArray
+ * @brief Append-only array safe for concurrent append() and get()
+ * @tparam T Element type (default constructible, copy/move assignable)
+ */
+template <typename T>
+class ConcurrentDynamicArray {
+  static constexpr size_t kFirst = 64;        // Size of segment 0
+  static constexpr int kFirstBits = 6;        // log2(kFirst)
+  static constexpr int kMaxSegments = 48;     // kFirst * 2^48 slots
+
+  /**
+   * @struct Segment
+   * @brief One fixed block of slots with per-slot ready flags
+   */
+  struct Segment {
+    unique_ptr<T[]> items;
+    unique_ptr<atomic<bool>[]> ready;
+    explicit Segment(size_t n) : items(new T[n]), ready(new atomic<bool>[n]) {
+      for (size_t i = 0; i < n; ++i) ready[i].store(false, memory_order_relaxed);
+    }
+  };
+
+  atomic<Segment*> segments_[kMaxSegments];   // Installed on first use
+  atomic<size_t> reserved_;                   // Slots claimed by writers
+  atomic<size_t> published_;                  // Prefix of slots fully written
+
+  /**
+   * @brief Maps a global index to its segment and offset
+   *
+   * Segment s covers [kFirst*(2^s - 1), kFirst*(2^(s+1) - 1)). With
+   * j = i/kFirst + 1, s is the index of j's highest set bit.
+   */
+  static void locate(size_t i, int& seg, size_t& off) {
+    size_t j = (i >> kFirstBits) + 1;
+    seg = 63 - __builtin_clzll(j);
+    off = i - ((kFirst << seg) - kFirst);
+  }
+
+  static size_t segment_size(int seg) { return kFirst << seg; }
+
+  /**
+   * @brief Returns segment seg, allocating it if nobody has yet
+   */
+  Segment* segment(int seg) {
+    Segment* s = segments_[seg].load(memory_order_acquire);
+    if (s) return s;
+    Segment* fresh = new Segment(segment_size(seg));
+    if (segments_[seg].compare_exchange_strong(s, fresh, memory_order_acq_rel)) return fresh;
+    delete fresh;   // Another writer installed it first
+    return s;
+  }
+
+  bool is_ready(size_t i) const {
+    int seg;
+    size_t off;
+    locate(i, seg, off);
+    Segment* s = segments_[seg].load(memory_order_acquire);
+    return s && s->ready[off].load();
+  }
+
+  /**
+   * @brief Advances published_ across every consecutive ready slot
+   *
+   * Any writer may advance it; a CAS failure means another thread moved it
+   * and we continue from the newer value. The ready flags use seq_cst so two
+   * writers finishing neighbouring slots cannot both miss each other's flag
+   * (the store-buffer reordering that acquire/release alone allows).
+   */
+  void publish() {
+    size_t p = published_.load();
+    while (p < reserved_.load() && is_ready(p)) {
+      if (published_.compare_exchange_weak(p, p + 1)) ++p;
+    }
+  }
+
+  public:
+  ConcurrentDynamicArray() : reserved_(0), published_(0) {
+    for (auto& s : segments_) s.store(nullptr, memory_order_relaxed);
+  }
+
+  ConcurrentDynamicArray(const ConcurrentDynamicArray&) = delete;
+  ConcurrentDynamicArray& operator=(const ConcurrentDynamicArray&) = delete;
+
+  ~ConcurrentDynamicArray() {
+    for (auto& s : segments_) delete s.load(memory_order_relaxed);
+  }
+
+  /**
+   * @brief Appends x from any thread
+   * @return Index at which x was stored
+   *
+   * Algorithm:
+   * 1. Claim index i with fetch_add (unique per caller)
+   * 2. Find or install the segment holding i and write the element
+   * 3. Mark the slot ready and try to advance the published size
+   */
+  size_t append(T x) {
+    size_t i = reserved_.fetch_add(1, memory_order_relaxed);
+    int seg;
+    size_t off;
+    locate(i, seg, off);
+    if (seg >= kMaxSegments) throw length_error("ConcurrentDynamicArray is full");
+    Segment* s = segment(seg);
+    s->items[off] = move(x);
+    s->ready[off].store(true);
+    publish();
+    return i;
+  }
+
+  /**
+   * @brief Number of elements visible to readers
+   *
+   * Every index below size() is fully written. Appends still in flight
+   * (claimed but not yet written) are not counted.
+   */
+  size_t size() const { return published_.load(memory_order_acquire); }
+
+  /**
+   * @brief Retrieves element at given index - O(1), never blocks
+   * @throws std::out_of_range if i >= size()
+   */
+  const T& get(size_t i) const {
+    if (i >= size()) throw out_of_range("Index out of bounds");
+    int seg;
+    size_t off;
+    locate(i, seg, off);
+    return segments_[seg].load(memory_order_acquire)->items[off];
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+/**
+ * An event fanned in from a worker thread.
+ */
+struct Event {
+  int worker = -1;
+  int seq = -1;
+};
+
+int main(int argc, char* argv[]) {
+  // Example 1: Single-threaded use behaves like append/get/size
+  ConcurrentDynamicArray<int> d1;
+  d1.append(1);
+  d1.append(2);
+  cout << d1.get(0) << "\n";   // returns 1
+  cout << d1.get(1) << "\n";   // returns 2
+  cout << d1.size() << "\n";   // returns 2
+
+  // Example 2: Many producers, one concurrent reader
+  int workers = argc > 1 ? atoi(argv[1]) : 8;
+  int per_worker = argc > 2 ? atoi(argv[2]) : 200000;
+  ConcurrentDynamicArray<Event> events;
+  atomic<bool> done{false};
+  long long reader_checks = 0;
+  bool reader_ok = true;
+
+  thread reader([&] {
+    // Every published element must be fully written
+    while (!done.load(memory_order_acquire)) {
+      size_t n = events.size();
+      if (n) {
+        const Event& e = events.get(n - 1);
+        reader_ok = reader_ok && e.worker >= 0 && e.seq >= 0;
+        ++reader_checks;
+      }
+    }
+  });
+
+  auto t0 = chrono::steady_clock::now();
+  vector<thread> producers;
+  for (int w = 0; w < workers; ++w) {
+    producers.emplace_back([&events, w, per_worker] {
+      for (int s = 0; s < per_worker; ++s) events.append(Event{w, s});
+    });
+  }
+  for (auto& t : producers) t.join();
+  double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+  done.store(true, memory_order_release);
+  reader.join();
+
+  // Each worker's events must all be present, in its own order
+  vector<int> next(workers, 0);
+  bool ordered = events.size() == static_cast<size_t>(workers) * per_worker;
+  for (size_t i = 0; ordered && i < events.size(); ++i) {
+    const Event& e = events.get(i);
+    ordered = e.seq == next[e.worker]++;
+  }
+  cout << boolalpha << workers << " producers x " << per_worker << " appends: size="
+       << events.size() << " per-worker order kept=" << ordered
+       << " reader saw only complete events=" << reader_ok << " ("
+       << reader_checks << " reads) in " << ms << "ms\n";
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why doubling segments?
+ * - Segment count stays O(log n), so locating index i is one bit scan and
+ *   the directory is a fixed array that never needs to grow or move.
+ *
+ * Why a ready flag per slot?
+ * - fetch_add hands out slots in order, but writers finish in any order.
+ *   size() may only cover slots whose element is completely written, so the
+ *   published prefix stops at the first slot that is still in flight.
+ *
+ * Why is a writer's own order preserved?
+ * - A single thread's fetch_add calls return increasing indices.
+ *
+ * Limits:
+ * - Append-only: no pop_back/insert/remove, since those would move or free
+ *   elements that concurrent readers may be looking at.
+ *
+ *============================================================================*/
@@ -0,0 +1,350 @@
+/**
+ * @file dynamic_arrays3.cc
+ * @brief Dynamic Array with range operations (append/insert/erase ranges)
+ *
+ * This file builds upon dynamic_arrays2.cc. Inserting or erasing k elements
+ * there means k calls to insert()/pop(), each shifting the whole tail and
+ * possibly resizing: O(k * n). The range operations below do the same work
+ * with a single tail shift and at most one resize.
+ *
+ * Key Concepts:
+ * - reserve(): compute the final capacity up front, resize at most once
+ * - memmove(): shift the tail by k positions in one call (regions overlap)
+ * - remove_if(): one read pointer, one write pointer - stable compaction
+ * - Shrinking after a bulk erase jumps straight to the final capacity
+ *
+ * Time Complexities:
+ * - reserve(c):              O(n) if it resizes, O(1) otherwise
+ * - append_range(k values):  O(k) + at most one O(n) resize
+ * - insert_range(i, k vals): O(n + k) - one tail shift
+ * - erase_range(i, j):       O(n) - one tail shift
+ * - remove_if(pred):         O(n) - single pass
+ * - all single-element operations as in dynamic_arrays2.cc
+ *
+ * Space Complexity: O(n) where n is the number of elements
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+/**
+ * @class DynamicArray
+ * @brief dynamic_arrays2.cc's array plus range operations
+ */
+class DynamicArray {
+  private:
+    int cap_;    // Current capacity (total allocated space)
+    int* arr_;   // Pointer to the underlying fixed-size array
+    int size_;   // Current number of elements stored
+
+    void resize(int newCap);
+    void shrink_if_sparse();
+
+  public:
+    DynamicArray(int size=10);
+    ~DynamicArray();
+    DynamicArray(const DynamicArray&) = delete;
+    DynamicArray& operator=(const DynamicArray&) = delete;
+
+    void append(int x);
+    int get(int i);
+    void set(int i, int x);
+    size_t size();
+    void pop_back();
+    int pop(int i);
+    bool contains(int x);
+    void insert(int i, int x);
+    int remove(int x);
+
+    /**
+     * @brief Ensures room for n elements with a single resize
+     * @param n Number of elements the array must be able to hold
+     *
+     * Capacity doubles until it exceeds n, so the amortized O(1) append
+     * guarantee is unchanged.
+     */
+    void reserve(int n);
+
+    /**
+     * @brief Appends count values to the end
+     *
+     * Time Complexity: O(count) + at most one resize
+     */
+    void append_range(const int* values, int count);
+    void append_range(const vector<int>& values);
+
+    /**
+     * @brief Inserts count values starting at index, in order
+     * @throws std::out_of_range if index is invalid (index < 0 or > size)
+     *
+     * Time Complexity: O(n + count) - the tail moves once, by count
+     */
+    void insert_range(int index, const int* values, int count);
+    void insert_range(int index, const vector<int>& values);
+
+    /**
+     * @brief Erases elements in [first, last)
+     * @return Number of elements erased
+     * @throws std::out_of_range if the range is invalid
+     *
+     * Time Complexity: O(n) - the tail moves once
+     */
+    int erase_range(int first, int last);
+
+    /**
+     * @brief Removes every element for which pred(x) is true
+     * @return Number of elements removed
+     *
+     * Keeps the order of the remaining elements.
+     * Time Complexity: O(n) - single pass
+     */
+    template <typename Pred>
+    int remove_if(Pred pred);
+};
+
+/*============================================================================
+ * IMPLEMENTATION SECTION
+ *============================================================================*/
+
+DynamicArray::DynamicArray(int size):cap_(size), arr_(new int[cap_]),size_(0) {};
+
+DynamicArray::~DynamicArray() {delete [] arr_;}
+
+void DynamicArray::resize(int newCap) {
+  int* temp = new int[newCap];
+  memcpy(temp, arr_, sizeof(int)*size_);
+  delete [] arr_;
+  arr_ = temp;
+  cap_ = newCap;
+}
+
+/**
+ * shrink_if_sparse() - halve until utilization is back above 25%
+ *
+ * After a bulk erase several halvings may be due; they are folded into one
+ * resize to the final capacity.
+ */
+void DynamicArray::shrink_if_sparse() {
+  int newCap = cap_;
+  while(newCap>10 && (static_cast<double>(size_)/newCap)<0.25) {
+    newCap /= 2;
+  }
+  if(newCap!=cap_) resize(newCap);
+}
+
+void DynamicArray::append(int x) {
+  arr_[size_] = x;
+  ++size_;
+  if(size_==cap_) {
+    resize(cap_*2);
+  }
+}
+
+int DynamicArray::get(int i) {
+  if (i < 0 || i >= size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  return arr_[i];
+}
+
+void DynamicArray::set(int i, int x) {
+ if (i < 0 || i >= size_) {
+  throw std::out_of_range("Index out of bounds");
+ }
+ arr_[i] = x;
+}
+
+size_t DynamicArray::size() {
+  return static_cast<size_t>(size_);
+}
+
+void DynamicArray::pop_back() {
+  if(size_==0) return;
+  size_--;
+  shrink_if_sparse();
+}
+
+int DynamicArray::pop(int index) {
+  if (index < 0 || index >= size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  int val = arr_[index];
+  erase_range(index, index+1);
+  return val;
+}
+
+bool DynamicArray::contains(int x) {
+  for(int i=0;i<size_;++i) {
+    if(arr_[i]==x) return true;
+  }
+  return false;
+}
+
+void DynamicArray::insert(int index, int x) {
+  insert_range(index, &x, 1);
+}
+
+int DynamicArray::remove(int x) {
+  for(int i=0;i<size_;++i) {
+    if(arr_[i]==x) {
+      pop(i);
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * reserve() - keep the "size < capacity" invariant of append()
+ */
+void DynamicArray::reserve(int n) {
+  if(n<cap_) return;
+  int newCap = cap_;
+  while(n>=newCap) newCap *= 2;
+  resize(newCap);
+}
+
+void DynamicArray::append_range(const int* values, int count) {
+  if(count<=0) return;
+  reserve(size_+count);
+  memcpy(arr_+size_, values, sizeof(int)*count);
+  size_ += count;
+}
+
+void DynamicArray::append_range(const vector<int>& values) {
+  append_range(values.data(), static_cast<int>(values.size()));
+}
+
+/**
+ * insert_range() - open a gap of count slots, then copy the values in
+ *
+ *   [a, b, c, d] insert_range(1, [x, y])
+ *   memmove tail by 2 -> [a, _, _, b, c, d]
+ *   memcpy values     -> [a, x, y, b, c, d]
+ *
+ * values must not point into this array (a resize would free them).
+ */
+void DynamicArray::insert_range(int index, const int* values, int count) {
+  if (index < 0 || index > size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  if(count<=0) return;
+  reserve(size_+count);
+  memmove(arr_+index+count, arr_+index, sizeof(int)*(size_-index));
+  memcpy(arr_+index, values, sizeof(int)*count);
+  size_ += count;
+}
+
+void DynamicArray::insert_range(int index, const vector<int>& values) {
+  insert_range(index, values.data(), static_cast<int>(values.size()));
+}
+
+/**
+ * erase_range() - close the gap with one memmove of the tail
+ *
+ *   [a, b, c, d, e] erase_range(1, 3) -> [a, d, e]
+ */
+int DynamicArray::erase_range(int first, int last) {
+  if (first < 0 || last > size_ || first > last) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  int count = last-first;
+  if(count==0) return 0;
+  memmove(arr_+first, arr_+last, sizeof(int)*(size_-last));
+  size_ -= count;
+  shrink_if_sparse();
+  return count;
+}
+
+/**
+ * remove_if() - stable compaction
+ *
+ * The write pointer w only advances for kept elements, so each kept
+ * element is copied at most once and in its original order.
+ */
+template <typename Pred>
+int DynamicArray::remove_if(Pred pred) {
+  int w = 0;
+  for(int r=0;r<size_;++r) {
+    if(!pred(arr_[r])) arr_[w++] = arr_[r];
+  }
+  int removed = size_-w;
+  size_ = w;
+  shrink_if_sparse();
+  return removed;
+}
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+void print(DynamicArray& d) {
+  for(size_t i=0;i<d.size();++i) cout<<d.get(i)<<" ";
+  cout<<"\n";
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: append_range
+  DynamicArray d1;
+  d1.append_range({1, 2, 3, 4, 5, 6});
+  print(d1);                                // 1 2 3 4 5 6
+
+  // Example 2: insert_range shifts the tail once
+  d1.insert_range(2, {10, 11, 12});
+  print(d1);                                // 1 2 10 11 12 3 4 5 6
+
+  // Example 3: erase_range removes [first, last)
+  cout<<d1.erase_range(1, 4)<<"\n";         // returns 3
+  print(d1);                                // 1 12 3 4 5 6
+
+  // Example 4: remove_if compacts in one pass, keeping order
+  cout<<d1.remove_if([](int x) { return x % 2 == 0; })<<"\n";   // returns 3
+  print(d1);                                // 1 3 5
+
+  // Example 5: Single-element operations still behave as in dynamic_arrays2.cc
+  d1.insert(1, 7);                          // [1, 7, 3, 5]
+  cout<<d1.remove(3)<<"\n";                 // returns 2
+  cout<<d1.pop(0)<<"\n";                    // returns 1
+  print(d1);                                // 7 5
+
+  // Example 6: k inserts at the front - one by one vs insert_range
+  int n = argc > 1 ? atoi(argv[1]) : 200000;
+  int k = argc > 2 ? atoi(argv[2]) : 1000;
+  vector<int> base(n, 1), batch(k, 2);
+  DynamicArray one, bulk;
+  one.append_range(base);
+  bulk.append_range(base);
+  auto t0 = chrono::steady_clock::now();
+  for(int i=0;i<k;++i) one.insert(i, batch[i]);
+  auto t1 = chrono::steady_clock::now();
+  bulk.insert_range(0, batch);
+  auto t2 = chrono::steady_clock::now();
+  cout<<k<<" inserts at front of "<<n<<": insert() x"<<k<<" "
+      <<chrono::duration<double, milli>(t1-t0).count()<<"ms, insert_range "
+      <<chrono::duration<double, milli>(t2-t1).count()<<"ms\n";
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Range operations added on top of dynamic_arrays2.cc:
+ * - append_range(values):     appends all values, in order
+ * - insert_range(i, values):  inserts all values starting at index i,
+ *                             shifting right elements at index i or greater
+ * - erase_range(i, j):        removes indices i..j-1, returns the count
+ * - remove_if(pred):          removes every element matching pred, returns
+ *                             the count
+ *
+ * Design rule:
+ * - Each operation moves the existing tail at most once and resizes the
+ *   underlying fixed-size array at most once, so k elements cost O(n + k)
+ *   instead of the O(n * k) of k single-element calls.
+ *
+ *============================================================================*/
@@ -0,0 +1,573 @@
+/**
+ * @file generic_dynamic_array.cc
+ * @brief Generic, move-aware Dynamic Array with a pluggable growth policy
+ *
+ * This file generalizes the int-only dynamic array (dynamic_arrays1.cc and
+ * dynamic_arrays2.cc) into DynamicArray<T, Allocator, GrowthPolicy>.
+ *
+ * Key Concepts:
+ * - Elements of any type T (strings, structs, move-only types)
+ * - Raw storage obtained from an Allocator; elements are constructed in place
+ * - Relocation on resize uses memcpy for trivially copyable T, otherwise
+ *   move construction (copy only if T's move constructor may throw)
+ * - emplace_back() constructs the new element directly in the array
+ * - The growth policy decides how capacity grows and when it shrinks
+ *
+ * Growth Policies:
+ * - DoublingGrowth:    x2 grow, halve below 25% full (dynamic_arrays1.cc rule)
+ *                      worst case 75% of capacity unused
+ * - GoldenGrowth:      x1.5 grow, shrink by 1.5 below 1/2.25 full
+ *                      worst case ~56% unused, freed blocks can be reused
+ * - ChunkedGrowth<C>:  x2 up to C elements, then +C per resize
+ *                      worst case C unused slots on large arrays
+ *
+ * Instrumentation (compile with -DDYNAMIC_ARRAY_STATS, e.g.
+ * `make generic_dynamic_array DEFS=-DDYNAMIC_ARRAY_STATS`):
+ * - Counts resizes, bytes relocated, elements shifted by insert/pop, shrink
+ *   checks, peak capacity and a histogram of size/capacity utilization
+ * - Read through stats(), printable with DynamicArrayStats::to_json()
+ * - Without the flag, the counters and every update compile away
+ *
+ * Time Complexities:
+ * - append()/emplace_back(): Amortized O(1) for geometric policies,
+ *                            amortized O(n/C) for ChunkedGrowth<C>
+ * - get()/set()/size():      O(1)
+ * - pop_back():              Amortized O(1)
+ * - pop(i)/insert(i, x):     O(n) - shifting
+ * - contains()/remove():     O(n) - linear search
+ *
+ * Space Complexity: O(n) where n is the number of elements
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/*============================================================================
+ * GROWTH POLICIES
+ *============================================================================*/
+
+/**
+ * Every policy provides two static functions:
+ * - grow(cap):         capacity to use when the array is full (> cap)
+ * - shrink(size, cap): capacity to use after a removal (cap = keep as is)
+ *
+ * kMinCap is the smallest capacity the array ever shrinks to.
+ */
+
+/**
+ * @struct DoublingGrowth
+ * @brief The original rule: double when full, halve below 25% utilization
+ */
+struct DoublingGrowth {
+  static constexpr size_t kMinCap = 10;
+  static size_t grow(size_t cap) { return cap < 1 ? 1 : cap * 2; }
+  static size_t shrink(size_t size, size_t cap) {
+    if (cap > kMinCap && size * 4 < cap) return cap / 2;
+    return cap;
+  }
+};
+
+/**
+ * @struct GoldenGrowth
+ * @brief Grow by 1.5x, shrink by 1.5x once below 1/2.25 utilization
+ *
+ * With a factor below the golden ratio, the sum of previously freed blocks
+ * eventually exceeds the next request, so the allocator can reuse them.
+ */
+struct GoldenGrowth {
+  static constexpr size_t kMinCap = 10;
+  static size_t grow(size_t cap) { return cap < 2 ? cap + 1 : cap + cap / 2; }
+  static size_t shrink(size_t size, size_t cap) {
+    if (cap > kMinCap && size * 9 < cap * 4) return cap * 2 / 3;
+    return cap;
+  }
+};
+
+/**
+ * @struct ChunkedGrowth
+ * @brief Double until Chunk elements, then grow linearly by Chunk
+ * @tparam Chunk Maximum number of slots added by a single resize
+ *
+ * Bounds the unused capacity of large arrays to about Chunk elements at the
+ * cost of more frequent resizes (amortized O(n/Chunk) per append).
+ */
+template <size_t Chunk = 4096>
+struct ChunkedGrowth {
+  static_assert(Chunk > 0, "Chunk must be positive");
+  static constexpr size_t kMinCap = 10;
+  static size_t grow(size_t cap) {
+    if (cap < 1) return 1;
+    return cap < Chunk ? cap * 2 : cap + Chunk;
+  }
+  static size_t shrink(size_t size, size_t cap) {
+    if (cap <= kMinCap) return cap;
+    if (cap <= Chunk) return size * 4 < cap ? cap / 2 : cap;
+    return cap - size > 2 * Chunk ? cap - Chunk : cap;
+  }
+};
+
+/*============================================================================
+ * INSTRUMENTATION
+ *============================================================================*/
+
+#ifdef DYNAMIC_ARRAY_STATS
+#define DA_STATS(...) __VA_ARGS__
+#else
+#define DA_STATS(...)
+#endif
+
+/**
+ * @struct DynamicArrayStats
+ * @brief Counters collected by a DynamicArray built with DYNAMIC_ARRAY_STATS
+ *
+ * utilization[b] counts mutations after which size/capacity fell in
+ * [b*10%, (b+1)*10%); a full array lands in the last bucket.
+ */
+struct DynamicArrayStats {
+#ifdef DYNAMIC_ARRAY_STATS
+  static constexpr bool enabled = true;
+#else
+  static constexpr bool enabled = false;
+#endif
+  static constexpr int kBuckets = 10;
+
+  uint64_t resizes = 0;           // Buffer reallocations (grow + shrink)
+  uint64_t grows = 0;             // Resizes to a larger capacity
+  uint64_t shrinks = 0;           // Resizes to a smaller capacity
+  uint64_t bytes_copied = 0;      // Bytes relocated by resizes
+  uint64_t elements_shifted = 0;  // Elements moved by insert(i)/pop(i)
+  uint64_t shrink_checks = 0;     // Times the shrink rule was evaluated
+  size_t peak_capacity = 0;       // Largest capacity ever allocated
+  uint64_t utilization[kBuckets] = {};
+
+  void record_resize(size_t oldCap, size_t newCap, size_t bytes) {
+    ++resizes;
+    (newCap > oldCap ? grows : shrinks) += 1;
+    bytes_copied += bytes;
+    if (newCap > peak_capacity) peak_capacity = newCap;
+  }
+
+  void sample(size_t size, size_t cap) {
+    size_t b = cap ? size * kBuckets / cap : 0;
+    ++utilization[b < kBuckets ? b : kBuckets - 1];
+  }
+
+  /**
+   * @brief Serializes every counter as a single-line JSON object
+   */
+  string to_json() const {
+    ostringstream out;
+    out << "{\"enabled\":" << (enabled ? "true" : "false")
+        << ",\"resizes\":" << resizes << ",\"grows\":" << grows
+        << ",\"shrinks\":" << shrinks << ",\"bytes_copied\":" << bytes_copied
+        << ",\"elements_shifted\":" << elements_shifted
+        << ",\"shrink_checks\":" << shrink_checks
+        << ",\"peak_capacity\":" << peak_capacity << ",\"utilization\":[";
+    for (int b = 0; b < kBuckets; ++b) out << (b ? "," : "") << utilization[b];
+    out << "]}";
+    return out.str();
+  }
+};
+
+/*============================================================================
+ * DYNAMIC ARRAY
+ *============================================================================*/
+
+/**
+ * @class DynamicArray
+ * @brief A resizable array of T with allocator and growth policy parameters
+ * @tparam T            Element type
+ * @tparam Allocator    Allocator used for the underlying buffer
+ * @tparam GrowthPolicy Capacity policy (DoublingGrowth, GoldenGrowth, ...)
+ *
+ * Keeps the API of dynamic_arrays2.cc (append, get, set, size, pop_back,
+ * pop, contains, insert, remove) and adds emplace_back().
+ */
+template <typename T, typename Allocator = allocator<T>,
+          typename GrowthPolicy = DoublingGrowth>
+class DynamicArray {
+  using Traits = allocator_traits<Allocator>;
+
+  Allocator alloc_;   // Allocator instance (usually empty)
+  size_t cap_;        // Current capacity (total allocated slots)
+  T* arr_;            // Pointer to the underlying raw storage
+  size_t size_;       // Current number of constructed elements
+#ifdef DYNAMIC_ARRAY_STATS
+  DynamicArrayStats stats_;   // Instrumentation counters
+#endif
+
+  /**
+   * @brief Moves n constructed elements from src to uninitialized dst
+   *
+   * Trivially copyable types are relocated with one memcpy. Other types are
+   * move constructed into dst and destroyed in src; if the move constructor
+   * may throw, elements are copied instead so src stays intact on failure.
+   */
+  void relocate(T* src, size_t n, T* dst) {
+    if constexpr (is_trivially_copyable_v<T>) {
+      if (n) memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+    } else {
+      size_t i = 0;
+      try {
+        for (; i < n; ++i)
+          Traits::construct(alloc_, dst + i, move_if_noexcept(src[i]));
+      } catch (...) {
+        destroy_range(dst, i);
+        throw;
+      }
+      destroy_range(src, n);
+    }
+  }
+
+  /**
+   * @brief Destroys n elements starting at p (no-op for trivial types)
+   */
+  void destroy_range(T* p, size_t n) {
+    if constexpr (!is_trivially_destructible_v<T>) {
+      for (size_t i = 0; i < n; ++i) Traits::destroy(alloc_, p + i);
+    }
+  }
+
+  /**
+   * @brief Resizes the internal buffer to a new capacity
+   * @param newCap The new capacity (must be >= size_)
+   *
+   * Time Complexity: O(n) - relocates all existing elements
+   */
+  void resize(size_t newCap) {
+    T* temp = Traits::allocate(alloc_, newCap);
+    try {
+      relocate(arr_, size_, temp);
+    } catch (...) {
+      Traits::deallocate(alloc_, temp, newCap);
+      throw;
+    }
+    Traits::deallocate(alloc_, arr_, cap_);
+    DA_STATS(stats_.record_resize(cap_, newCap, size_ * sizeof(T)));
+    arr_ = temp;
+    cap_ = newCap;
+  }
+
+  /**
+   * @brief Applies the policy's shrink rule after a removal
+   */
+  void maybe_shrink() {
+    DA_STATS(++stats_.shrink_checks);
+    size_t newCap = GrowthPolicy::shrink(size_, cap_);
+    if (newCap < cap_ && newCap >= size_) resize(newCap);
+  }
+
+  void check_index(size_t i) const {
+    if (i >= size_) throw out_of_range("Index out of bounds");
+  }
+
+  public:
+  /**
+   * @brief Constructor - creates an empty array with initial capacity
+   * @param size Initial capacity (default: 10)
+   */
+  explicit DynamicArray(size_t size = 10, const Allocator& alloc = Allocator())
+      : alloc_(alloc), cap_(size < 1 ? 1 : size),
+        arr_(Traits::allocate(alloc_, cap_)), size_(0) {
+    DA_STATS(stats_.peak_capacity = cap_);
+  }
+
+  /**
+   * @brief Copy constructor - deep copies every element
+   */
+  DynamicArray(const DynamicArray& other)
+      : alloc_(Traits::select_on_container_copy_construction(other.alloc_)),
+        cap_(other.cap_), arr_(Traits::allocate(alloc_, cap_)), size_(0) {
+    try {
+      for (; size_ < other.size_; ++size_)
+        Traits::construct(alloc_, arr_ + size_, other.arr_[size_]);
+    } catch (...) {
+      destroy_range(arr_, size_);
+      Traits::deallocate(alloc_, arr_, cap_);
+      throw;
+    }
+  }
+
+  /**
+   * @brief Move constructor - steals the buffer, O(1)
+   */
+  DynamicArray(DynamicArray&& other) noexcept
+      : alloc_(move(other.alloc_)), cap_(other.cap_), arr_(other.arr_),
+        size_(other.size_) {
+    other.arr_ = nullptr;
+    other.cap_ = 0;
+    other.size_ = 0;
+  }
+
+  /**
+   * @brief Copy/move assignment via copy-and-swap
+   */
+  DynamicArray& operator=(DynamicArray other) noexcept {
+    swap(alloc_, other.alloc_);
+    swap(cap_, other.cap_);
+    swap(arr_, other.arr_);
+    swap(size_, other.size_);
+    return *this;
+  }
+
+  /**
+   * @brief Destructor - destroys elements and frees the buffer
+   */
+  ~DynamicArray() {
+    destroy_range(arr_, size_);
+    if (arr_) Traits::deallocate(alloc_, arr_, cap_);
+  }
+
+  /**
+   * @brief Constructs an element in place at the end of the array
+   * @param args Arguments forwarded to T's constructor
+   * @return Reference to the new element
+   *
+   * When the array is full the new element is constructed in the new buffer
+   * before the old elements are relocated, so args may safely refer to an
+   * element of this array.
+   */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    if (size_ < cap_ && arr_) {
+      Traits::construct(alloc_, arr_ + size_, forward<Args>(args)...);
+      DA_STATS(stats_.sample(size_ + 1, cap_));
+      return arr_[size_++];
+    }
+    size_t newCap = GrowthPolicy::grow(cap_);
+    T* temp = Traits::allocate(alloc_, newCap);
+    try {
+      Traits::construct(alloc_, temp + size_, forward<Args>(args)...);
+    } catch (...) {
+      Traits::deallocate(alloc_, temp, newCap);
+      throw;
+    }
+    try {
+      relocate(arr_, size_, temp);
+    } catch (...) {
+      Traits::destroy(alloc_, temp + size_);
+      Traits::deallocate(alloc_, temp, newCap);
+      throw;
+    }
+    if (arr_) Traits::deallocate(alloc_, arr_, cap_);
+    DA_STATS(stats_.record_resize(cap_, newCap, size_ * sizeof(T)));
+    DA_STATS(stats_.sample(size_ + 1, newCap));
+    arr_ = temp;
+    cap_ = newCap;
+    return arr_[size_++];
+  }
+
+  /**
+   * @brief Adds an element to the end of the array (copy or move)
+   */
+  void append(const T& x) { emplace_back(x); }
+  void append(T&& x) { emplace_back(move(x)); }
+
+  /**
+   * @brief Retrieves element at given index
+   * @throws std::out_of_range if index is invalid
+   */
+  T& get(size_t i) { check_index(i); return arr_[i]; }
+  const T& get(size_t i) const { check_index(i); return arr_[i]; }
+
+  /**
+   * @brief Updates element at given index
+   * @throws std::out_of_range if index is invalid
+   */
+  void set(size_t i, T x) { check_index(i); arr_[i] = move(x); }
+
+  /**
+   * @brief Returns the current number of elements
+   */
+  size_t size() const { return size_; }
+
+  /**
+   * @brief Returns the current capacity (allocated slots)
+   */
+  size_t capacity() const { return cap_; }
+
+  /**
+   * @brief Instrumentation counters (all zero unless DYNAMIC_ARRAY_STATS)
+   */
+  const DynamicArrayStats& stats() const {
+#ifdef DYNAMIC_ARRAY_STATS
+    return stats_;
+#else
+    static const DynamicArrayStats disabled;
+    return disabled;
+#endif
+  }
+
+  /**
+   * @brief Removes the last element, shrinking per the growth policy
+   */
+  void pop_back() {
+    if (size_ == 0) return;
+    --size_;
+    Traits::destroy(alloc_, arr_ + size_);
+    maybe_shrink();
+    DA_STATS(stats_.sample(size_, cap_));
+  }
+
+  /**
+   * @brief Removes and returns element at specified index
+   * @throws std::out_of_range if index is invalid
+   *
+   * Time Complexity: O(n) - moves every later element left by one
+   */
+  T pop(size_t index) {
+    check_index(index);
+    T val = move(arr_[index]);
+    for (size_t i = index; i + 1 < size_; ++i) arr_[i] = move(arr_[i + 1]);
+    DA_STATS(stats_.elements_shifted += size_ - 1 - index);
+    --size_;
+    Traits::destroy(alloc_, arr_ + size_);
+    maybe_shrink();
+    DA_STATS(stats_.sample(size_, cap_));
+    return val;
+  }
+
+  /**
+   * @brief Checks if element exists in the array
+   *
+   * Time Complexity: O(n) - linear search
+   */
+  bool contains(const T& x) const {
+    for (size_t i = 0; i < size_; ++i)
+      if (arr_[i] == x) return true;
+    return false;
+  }
+
+  /**
+   * @brief Inserts element at specified index
+   * @throws std::out_of_range if index > size
+   *
+   * Time Complexity: O(n) - moves every element at/after index right by one
+   */
+  void insert(size_t index, T x) {
+    if (index > size_) throw out_of_range("Index out of bounds");
+    if (index == size_) { emplace_back(move(x)); return; }
+    DA_STATS(stats_.elements_shifted += size_ - index);
+    emplace_back(move(arr_[size_ - 1]));     // Last element into new slot
+    for (size_t i = size_ - 2; i > index; --i) arr_[i] = move(arr_[i - 1]);
+    arr_[index] = move(x);
+  }
+
+  /**
+   * @brief Removes first occurrence of specified element
+   * @return Index where element was found, or -1 if not found
+   *
+   * Time Complexity: O(n) - linear search + shifting
+   */
+  long long remove(const T& x) {
+    for (size_t i = 0; i < size_; ++i) {
+      if (arr_[i] == x) {
+        pop(i);
+        return static_cast<long long>(i);
+      }
+    }
+    return -1;
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+/**
+ * A non-trivial element type that counts how it gets relocated.
+ */
+struct Track {
+  static inline int copies = 0;
+  static inline int moves = 0;
+  string title;
+  int plays;
+  Track(string t, int p) : title(move(t)), plays(p) {}
+  Track(const Track& o) : title(o.title), plays(o.plays) { ++copies; }
+  Track(Track&& o) noexcept : title(move(o.title)), plays(o.plays) { ++moves; }
+  Track& operator=(const Track&) = default;
+  Track& operator=(Track&&) noexcept = default;
+  bool operator==(const Track& o) const { return title == o.title; }
+};
+
+/**
+ * @brief Fills an array with n ints and reports final capacity and waste
+ */
+template <typename Policy>
+void report_capacity(const char* name, size_t n) {
+  DynamicArray<int, allocator<int>, Policy> d;
+  size_t resizes = 0, cap = d.capacity();
+  for (size_t i = 0; i < n; ++i) {
+    d.append(static_cast<int>(i));
+    if (d.capacity() != cap) { ++resizes; cap = d.capacity(); }
+  }
+  cout << name << ": size=" << d.size() << " cap=" << d.capacity()
+       << " unused=" << 100.0 * (d.capacity() - d.size()) / d.capacity()
+       << "% resizes=" << resizes << "\n";
+  if (DynamicArrayStats::enabled) cout << "  " << d.stats().to_json() << "\n";
+}
+
+int main() {
+  // Example 1: Same API as dynamic_arrays2.cc, now with strings
+  DynamicArray<string> d1;
+  d1.append("Boolean Rhapsody");
+  d1.append("Coding In The Deep");
+  d1.insert(1, "Hey Queue");               // [Boolean, Hey Queue, Coding]
+  cout << d1.get(1) << "\n";               // Hey Queue
+  cout << boolalpha << d1.contains("Coding In The Deep") << "\n";  // true
+  cout << d1.remove("Boolean Rhapsody") << "\n";                   // 0
+  cout << d1.pop(0) << "\n";               // Hey Queue
+  cout << d1.size() << "\n";               // 1
+
+  // Example 2: emplace_back constructs in place; resizes move, never copy
+  DynamicArray<Track> d2(2);
+  for (int i = 0; i < 100; ++i) d2.emplace_back("track" + to_string(i), i);
+  cout << d2.get(99).title << " copies=" << Track::copies
+       << " moves=" << Track::moves << "\n";  // copies=0
+
+  // Example 3: Move-only element type
+  DynamicArray<unique_ptr<int>> d3;
+  for (int i = 0; i < 20; ++i) d3.emplace_back(make_unique<int>(i));
+  cout << *d3.get(19) << "\n";             // 19
+
+  // Example 4: Capacity left unused by each growth policy
+  const size_t n = 1000001;
+  report_capacity<DoublingGrowth>("DoublingGrowth      ", n);
+  report_capacity<GoldenGrowth>("GoldenGrowth        ", n);
+  report_capacity<ChunkedGrowth<65536>>("ChunkedGrowth<65536>", n);
+
+  // Example 5: Instrumentation of shifting and shrinking
+  DynamicArray<int> d5;
+  for (int i = 0; i < 1000; ++i) d5.insert(0, i);
+  while (d5.size() > 10) d5.pop(d5.size() / 2);
+  cout << d5.stats().to_json() << "\n";   // all zero unless DYNAMIC_ARRAY_STATS
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why memcpy for trivially copyable T?
+ * - Such types have no user-visible copy/move/destroy logic, so copying
+ *   their bytes is a valid relocation and compiles to a single memmove.
+ *
+ * Why move_if_noexcept?
+ * - If a move constructor throws halfway through a resize, the moved-from
+ *   source elements cannot be restored. Copying keeps the old buffer intact,
+ *   giving the strong exception guarantee (same rule as std::vector).
+ *
+ * Choosing a growth policy:
+ * - DoublingGrowth: fewest resizes, up to 75% of capacity unused
+ * - GoldenGrowth:   ~1.7x more resizes, allocator can reuse freed blocks
+ * - ChunkedGrowth:  bounded absolute waste, linear number of resizes
+ *
+ *============================================================================*/
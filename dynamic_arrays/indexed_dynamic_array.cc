@@ -0,0 +1,540 @@
+/**
+ * @file indexed_dynamic_array.cc
+ * @brief Dynamic Array with an optional hash side-index for O(1) lookups
+ *
+ * In dynamic_arrays2.cc, contains(x) and remove(x) scan the array linearly.
+ * This file adds an opt-in PositionIndex: an open-addressing hash table
+ * from each distinct value to the sorted, doubly linked list of its
+ * positions (links stored in arrays indexed by position). With the index
+ * enabled:
+ *
+ * - contains(x): probe the home slot of x                    -> O(1) average
+ * - remove(x):   the slot holds x's smallest position        -> O(1) average
+ *                then pop(position)
+ *
+ * Every mutation keeps the index in sync (d = duplicates of the value):
+ * - append / pop_back: link / unlink the last position       -> O(1)
+ * - set(i, x):         unlink i from old, link i into x      -> O(1 + d)
+ * - insert / pop:      every shifted element's links are
+ *                      rewritten in O(1) (no rehash, the hash only
+ *                      depends on the value)                 -> O(n + d)
+ *
+ * Key Concepts:
+ * - Linear probing with backward-shift deletion (no tombstones)
+ * - Duplicates never share a probe scan: each position has its own links
+ * - Multiplicative (Fibonacci) hashing of the value
+ * - Index is opt-in, per array: DynamicArray(size, true) or set_indexed()
+ *
+ * Time Complexities (index on):
+ * - contains():          O(1) average
+ * - remove():            O(1) average lookup + O(n) shift
+ * - append()/pop_back(): Amortized O(1), larger constant than index off
+ * - set():               O(1 + d)
+ * - insert()/pop():      O(n + d), a few link writes per shifted element
+ *
+ * Space Complexity: O(n) - the index adds 8 bytes per element plus
+ * ~24 bytes per distinct value
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+/*============================================================================
+ * POSITION INDEX
+ *============================================================================*/
+
+/**
+ * @class PositionIndex
+ * @brief Map from value to the sorted list of its array positions
+ *
+ * An open-addressing table holds one slot per distinct value with the
+ * first and last position of that value (head == -1 marks an empty slot).
+ * The positions of one value form a doubly linked list threaded through
+ * next_/prev_, which are indexed by position:
+ *
+ *   array:  [7, 3, 7, 7]      slot(7): head 0, tail 3
+ *   next_:  [2, -, 3, -1]     7 at 0 -> 2 -> 3
+ *
+ * So the entry for one position is found without scanning the other
+ * duplicates of its value, and a shift moves each entry in O(1).
+ */
+class PositionIndex {
+  struct Slot {
+    int value;
+    int head;   // Smallest position of value, -1 if the slot is empty
+    int tail;   // Largest position of value
+  };
+
+  vector<Slot> slots_;      // Table, size is a power of two
+  size_t mask_;             // slots_.size() - 1
+  int shift_;               // 64 - log2(slots_.size())
+  size_t used_;             // Number of occupied slots (distinct values)
+  vector<int> next_, prev_; // Per position: same-value neighbours, -1 at ends
+
+  size_t home(int v) const {
+    uint64_t h = static_cast<uint64_t>(static_cast<uint32_t>(v)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(h >> shift_);
+  }
+
+  /**
+   * @brief Slot of v, or the empty slot that ends its probe run
+   */
+  size_t find_slot(int v) const {
+    size_t i = home(v);
+    while (slots_[i].head != -1 && slots_[i].value != v) i = (i + 1) & mask_;
+    return i;
+  }
+
+  /**
+   * @brief Slot of v, which must be present
+   * @throws std::logic_error if v is missing (index out of sync)
+   */
+  Slot& slot_of(int v) {
+    Slot& s = slots_[find_slot(v)];
+    if (s.head == -1) throw logic_error("PositionIndex out of sync");
+    return s;
+  }
+
+  void rehash(size_t newSize) {
+    vector<Slot> old = move(slots_);
+    slots_.assign(newSize, Slot{0, -1, -1});
+    mask_ = newSize - 1;
+    shift_ = 64 - __builtin_ctzll(newSize);
+    for (const Slot& s : old)
+      if (s.head != -1) slots_[find_slot(s.value)] = s;
+  }
+
+  /**
+   * @brief Empties slot `hole` with backward-shift deletion
+   *
+   * Later slots of the probe run move back into the hole when their home
+   * slot allows it, so lookups never need tombstones.
+   */
+  void erase_slot(size_t hole) {
+    for (size_t j = (hole + 1) & mask_; slots_[j].head != -1; j = (j + 1) & mask_) {
+      size_t k = home(slots_[j].value);
+      // Move j into the hole unless its home lies cyclically in (hole, j]
+      bool stays = (hole <= j) ? (hole < k && k <= j) : (hole < k || k <= j);
+      if (!stays) {
+        slots_[hole] = slots_[j];
+        hole = j;
+      }
+    }
+    slots_[hole].head = -1;
+    --used_;
+  }
+
+  void reserve_pos(int pos) {
+    if (static_cast<size_t>(pos) < next_.size()) return;
+    size_t n = max(static_cast<size_t>(pos) + 1, next_.size() * 2);
+    next_.resize(n, -1);
+    prev_.resize(n, -1);
+  }
+
+  public:
+  PositionIndex() : used_(0) { rehash(16); }
+
+  /**
+   * @brief Adds position pos for v; keeps load factor at most 1/2
+   *
+   * O(1) if pos is v's largest position (append), else O(d) to find its
+   * place among the d positions of v.
+   */
+  void insert(int v, int pos) {
+    reserve_pos(pos);
+    size_t i = find_slot(v);
+    if (slots_[i].head == -1) {
+      if ((used_ + 1) * 2 > slots_.size()) {
+        rehash(slots_.size() * 2);
+        i = find_slot(v);
+      }
+      slots_[i] = Slot{v, pos, pos};
+      next_[pos] = prev_[pos] = -1;
+      ++used_;
+      return;
+    }
+    Slot& s = slots_[i];
+    if (pos > s.tail) {
+      prev_[pos] = s.tail;
+      next_[pos] = -1;
+      next_[s.tail] = pos;
+      s.tail = pos;
+      return;
+    }
+    int after = s.head;   // First position of v greater than pos
+    while (after < pos) after = next_[after];
+    int before = prev_[after];
+    prev_[pos] = before;
+    next_[pos] = after;
+    prev_[after] = pos;
+    if (before == -1) s.head = pos;
+    else next_[before] = pos;
+  }
+
+  /**
+   * @brief Removes position pos of v - O(1) average
+   */
+  void erase(int v, int pos) {
+    size_t i = find_slot(v);
+    if (slots_[i].head == -1) throw logic_error("PositionIndex out of sync");
+    Slot& s = slots_[i];
+    int p = prev_[pos], n = next_[pos];
+    if (p == -1) s.head = n;
+    else next_[p] = n;
+    if (n == -1) s.tail = p;
+    else prev_[n] = p;
+    if (s.head == -1) erase_slot(i);
+  }
+
+  /**
+   * @brief Moves the entry of v at `from` to the free position `to`
+   *
+   * Shifts move every entry by one in the same direction, so `to` keeps
+   * its place in v's sorted list: only the links are rewritten - O(1).
+   */
+  void move_entry(int v, int from, int to) {
+    reserve_pos(to);
+    int p = prev_[from], n = next_[from];
+    prev_[to] = p;
+    next_[to] = n;
+    if (p == -1 || n == -1) {
+      Slot& s = slot_of(v);
+      if (p == -1) s.head = to;
+      if (n == -1) s.tail = to;
+    }
+    if (p != -1) next_[p] = to;
+    if (n != -1) prev_[n] = to;
+  }
+
+  /**
+   * @brief Smallest position stored for v, or -1 if v is absent - O(1)
+   */
+  int first(int v) const { return slots_[find_slot(v)].head; }
+
+  bool contains(int v) const { return first(v) != -1; }
+
+  void clear() {
+    slots_.clear();
+    used_ = 0;
+    rehash(16);
+    next_.clear();
+    prev_.clear();
+  }
+};
+
+/*============================================================================
+ * DYNAMIC ARRAY
+ *============================================================================*/
+
+/**
+ * @class DynamicArray
+ * @brief dynamic_arrays2.cc's array with an opt-in PositionIndex
+ */
+class DynamicArray {
+  private:
+    int cap_;              // Current capacity (total allocated space)
+    int* arr_;             // Pointer to the underlying fixed-size array
+    int size_;             // Current number of elements stored
+    bool indexed_;         // Whether index_ is maintained
+    PositionIndex index_;  // value -> positions (only if indexed_)
+
+    void resize(int newCap);
+    void shrink_if_sparse();
+
+  public:
+    /**
+     * @brief Constructor - creates a dynamic array with initial capacity
+     * @param size Initial capacity (default: 10)
+     * @param indexed Maintain the hash side-index (default: false)
+     */
+    DynamicArray(int size=10, bool indexed=false);
+    ~DynamicArray();
+    DynamicArray(const DynamicArray&) = delete;
+    DynamicArray& operator=(const DynamicArray&) = delete;
+
+    /**
+     * @brief Turns the side-index on (built in O(n)) or off (dropped)
+     */
+    void set_indexed(bool on);
+    bool indexed() const { return indexed_; }
+
+    void append(int x);
+    int get(int i);
+    void set(int i, int x);
+    size_t size();
+    void pop_back();
+    int pop(int i);
+
+    /**
+     * @brief Checks if element exists - O(1) average when indexed
+     */
+    bool contains(int x);
+
+    void insert(int i, int x);
+
+    /**
+     * @brief Removes first occurrence of x
+     * @return Index where element was found, or -1 if not found
+     *
+     * The lookup is O(1) average when indexed; the shift stays O(n).
+     */
+    int remove(int x);
+};
+
+/*============================================================================
+ * IMPLEMENTATION SECTION
+ *============================================================================*/
+
+DynamicArray::DynamicArray(int size, bool indexed)
+    : cap_(size), arr_(new int[cap_]), size_(0), indexed_(indexed) {}
+
+DynamicArray::~DynamicArray() {delete [] arr_;}
+
+void DynamicArray::resize(int newCap) {
+  int* temp = new int[newCap];
+  for(int i=0;i<size_;++i) temp[i] = arr_[i];
+  delete [] arr_;
+  arr_ = temp;
+  cap_ = newCap;
+}
+
+void DynamicArray::shrink_if_sparse() {
+  if(cap_>10 && (static_cast<double>(size_)/cap_)<0.25) {
+    resize(cap_/2);
+  }
+}
+
+void DynamicArray::set_indexed(bool on) {
+  if(on==indexed_) return;
+  index_.clear();
+  indexed_ = on;
+  if(on) {
+    for(int i=0;i<size_;++i) index_.insert(arr_[i], i);
+  }
+}
+
+void DynamicArray::append(int x) {
+  if(indexed_) index_.insert(x, size_);
+  arr_[size_] = x;
+  ++size_;
+  if(size_==cap_) {
+    resize(cap_*2);
+  }
+}
+
+int DynamicArray::get(int i) {
+  if (i < 0 || i >= size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  return arr_[i];
+}
+
+void DynamicArray::set(int i, int x) {
+ if (i < 0 || i >= size_) {
+  throw std::out_of_range("Index out of bounds");
+ }
+ if(indexed_ && arr_[i]!=x) {
+   index_.erase(arr_[i], i);
+   index_.insert(x, i);
+ }
+ arr_[i] = x;
+}
+
+size_t DynamicArray::size() {
+  return static_cast<size_t>(size_);
+}
+
+void DynamicArray::pop_back() {
+  if(size_==0) return;
+  size_--;
+  if(indexed_) index_.erase(arr_[size_], size_);
+  shrink_if_sparse();
+}
+
+/**
+ * pop(index) - shift left, moving each shifted element's index entry
+ * from position i+1 to i in ascending order (so positions never collide)
+ */
+int DynamicArray::pop(int index) {
+  if (index < 0 || index >= size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  int val = arr_[index];
+  if(indexed_) index_.erase(val, index);
+  for(int i=index;i<size_-1;++i) {
+    arr_[i] = arr_[i+1];
+    if(indexed_) index_.move_entry(arr_[i], i+1, i);
+  }
+  size_--;
+  shrink_if_sparse();
+  return val;
+}
+
+bool DynamicArray::contains(int x) {
+  if(indexed_) return index_.contains(x);
+  for(int i=0;i<size_;++i) {
+    if(arr_[i]==x) return true;
+  }
+  return false;
+}
+
+/**
+ * insert(index, x) - shift right, moving index entries from i-1 to i in
+ * descending order, then register x at index
+ */
+void DynamicArray::insert(int index, int x) {
+  if (index < 0 || index > size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  if(size_+1==cap_) {
+    resize(cap_*2);
+  }
+  for(int i=size_;i>index;--i) {
+    arr_[i] = arr_[i-1];
+    if(indexed_) index_.move_entry(arr_[i], i-1, i);
+  }
+  size_++;
+  arr_[index] = x;
+  if(indexed_) index_.insert(x, index);
+}
+
+int DynamicArray::remove(int x) {
+  int index = -1;
+  if(indexed_) {
+    index = index_.first(x);
+  } else {
+    for(int i=0;i<size_;++i) {
+      if(arr_[i]==x) {
+        index=i;
+        break;
+      }
+    }
+  }
+  if(index==-1) return index;
+  pop(index);
+  return index;
+}
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+using Clock = chrono::steady_clock;
+
+double ns_per_op(Clock::time_point t0, long long ops) {
+  return chrono::duration<double, nano>(Clock::now() - t0).count() / ops;
+}
+
+/**
+ * @brief Measures mutation and lookup cost with the index off or on
+ * @param distinct Number of distinct values appended (n / distinct copies each)
+ */
+void benchmark(bool indexed, int n, int ops, int distinct) {
+  DynamicArray d(10, indexed);
+  mt19937 rng(7);
+  auto t0 = Clock::now();
+  for (int i = 0; i < n; ++i) d.append(static_cast<int>(rng() % distinct));
+  double append_ns = ns_per_op(t0, n);
+
+  t0 = Clock::now();
+  for (int r = 0; r < ops; ++r) d.set(rng() % n, static_cast<int>(rng() % n));
+  double set_ns = ns_per_op(t0, ops);
+
+  t0 = Clock::now();
+  for (int r = 0; r < ops; ++r) { d.insert(n / 2, r); d.pop(n / 2); }
+  double shift_ns = ns_per_op(t0, ops);
+
+  t0 = Clock::now();
+  int hits = 0;
+  for (int r = 0; r < ops; ++r) hits += d.contains(static_cast<int>(rng() % (2 * n)));
+  double contains_ns = ns_per_op(t0, ops);
+
+  t0 = Clock::now();
+  for (int r = 0; r < ops; ++r) {
+    int x = static_cast<int>(rng() % n);
+    if (d.remove(x) != -1) d.append(x);
+  }
+  double remove_ns = ns_per_op(t0, ops);
+
+  cout << (indexed ? "index on " : "index off") << "  distinct=" << distinct << "  append=" << append_ns
+       << "  set=" << set_ns << "  insert+pop(mid)=" << shift_ns
+       << "  contains=" << contains_ns << "  remove+append=" << remove_ns
+       << "  (ns/op, hits=" << hits << ")\n";
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: Same results as dynamic_arrays2.cc with the index enabled
+  DynamicArray d1(10, true);
+  d1.append(1);
+  d1.append(2);
+  d1.append(3);
+  cout << d1.pop(1) << "\n";    // returns 2
+  cout << d1.get(1) << "\n";    // returns 3
+  cout << boolalpha;
+  cout << d1.contains(1) << "\n";   // true
+  cout << d1.contains(2) << "\n";   // false
+  d1.insert(1, 3);                  // [1, 3, 3]
+  cout << d1.remove(3) << "\n";     // 1 (first index where 3 appears)
+  cout << d1.get(1) << "\n";        // 3 (the second 3 shifted left)
+  d1.set(1, 9);
+  cout << d1.contains(3) << " " << d1.contains(9) << "\n";  // false true
+
+  // Example 2: Indexed and plain arrays agree under random operations,
+  // with few duplicates (50 values) and many (3 values)
+  bool ok = true;
+  for (int values : {50, 3}) {
+    DynamicArray plain, fast(10, true);
+    mt19937 rng(1);
+    for (int step = 0; step < 20000 && ok; ++step) {
+      int x = static_cast<int>(rng() % values);
+      int pos = plain.size() ? static_cast<int>(rng() % plain.size()) : 0;
+      switch (plain.size() ? rng() % 6 : 0) {
+        case 0: plain.append(x); fast.append(x); break;
+        case 1: plain.set(pos, x); fast.set(pos, x); break;
+        case 2: plain.insert(pos, x); fast.insert(pos, x); break;
+        case 3: ok = plain.pop(pos) == fast.pop(pos); break;
+        case 4: plain.pop_back(); fast.pop_back(); break;
+        case 5: ok = plain.remove(x) == fast.remove(x); break;
+      }
+      ok = ok && plain.contains(x) == fast.contains(x);
+    }
+  }
+  cout << "indexed matches plain: " << ok << "\n";
+
+  // Example 3: Cost of the index on mutations vs savings on lookups
+  int n = argc > 1 ? atoi(argv[1]) : 100000;
+  int ops = argc > 2 ? atoi(argv[2]) : 500;
+  cout << "n=" << n << "\n";
+  benchmark(false, n, ops, n);
+  benchmark(true, n, ops, n);
+  benchmark(true, n, ops, 1);   // All equal: shifts stay O(n), not O(n * d)
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * When to enable the index:
+ * - Lookup-heavy workloads (contains/remove dominate): yes, O(n) -> O(1)
+ * - Insert/pop-at-index heavy workloads: no, each shifted element now also
+ *   rewrites its links (and probes the table at a list end), so the O(n)
+ *   shift gets several times slower
+ * - append/set-only workloads: small constant overhead per mutation
+ *
+ * Why per-position links instead of one (value, pos) entry per element?
+ * - With one entry per element, all duplicates of a value share a probe
+ *   run; finding (v, pos) scans all d of them, and a shift over an array
+ *   of equal values costs O(n * d) = O(n^2).
+ *
+ * Why backward-shift deletion?
+ * - Tombstones would accumulate under the constant erase/insert churn of
+ *   set() and pop(), slowing every probe until a rehash.
+ *
+ *============================================================================*/
@@ -0,0 +1,317 @@
+/**
+ * @file persistent_dynamic_array.cc
+ * @brief Memory-mapped, file-backed persistent Dynamic Array
+ *
+ * The arrays in dynamic_arrays1.cc live in process memory and must be
+ * rebuilt on every start. This array keeps its elements in a file that is
+ * mmap()-ed MAP_SHARED, so the file *is* the array:
+ *
+ *   file offset 0                64
+ *   ┌────────────────────────────┬────┬────┬────┬─────┬─────────┐
+ *   │ Header: magic, version,    │ e0 │ e1 │ e2 │ ... │ unused  │
+ *   │ elem_size, size, capacity  │    │    │    │     │         │
+ *   └────────────────────────────┴────┴────┴────┴─────┴─────────┘
+ *                                 ↑ size elements    ↑ capacity slots
+ *
+ * Key Concepts:
+ * - Opening an existing file validates the header and maps it: O(1), no
+ *   parsing; pages are faulted in lazily as elements are touched
+ * - Growth doubles capacity: ftruncate() extends the file, then the mapping
+ *   is extended with mremap()
+ * - size lives in the header, so every append is immediately part of the
+ *   file (sync() forces it to disk with msync)
+ * - Only trivially copyable T can be stored (raw bytes on disk)
+ *
+ * Time Complexities:
+ * - open():              O(1) for an existing file
+ * - append():            Amortized O(1)
+ * - get()/set()/size():  O(1)
+ * - pop_back():          Amortized O(1)
+ *
+ * Space Complexity: O(n) on disk; resident memory only for touched pages
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/**
+ * @class PersistentDynamicArray
+ * @brief Dynamic array stored in a memory-mapped file
+ * @tparam T Element type (must be trivially copyable)
+ */
+template <typename T>
+class PersistentDynamicArray {
+  static_assert(is_trivially_copyable_v<T>,
+                "elements are stored as raw bytes; T must be trivially copyable");
+  static_assert(alignof(T) <= 64, "elements start at file offset 64");
+
+  static constexpr uint64_t kMagic = 0x5241594144594e44ull;   // "DNYDAYAR"
+  static constexpr uint32_t kVersion = 1;
+  static constexpr size_t kHeaderBytes = 64;
+  static constexpr uint64_t kMinCap = 10;
+
+  /**
+   * @struct Header
+   * @brief First 64 bytes of the file
+   */
+  struct Header {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t elem_size;
+    uint64_t size;       // Number of elements stored
+    uint64_t capacity;   // Element slots backed by the file
+  };
+  static_assert(sizeof(Header) <= kHeaderBytes, "header must fit in 64 bytes");
+
+  int fd_;            // Open file descriptor
+  void* base_;        // Start of the mapping (the header)
+  size_t mapped_;     // Bytes mapped == file_bytes(capacity) <= file size
+
+  Header* header() const { return static_cast<Header*>(base_); }
+  T* data() const {
+    return reinterpret_cast<T*>(static_cast<char*>(base_) + kHeaderBytes);
+  }
+
+  static size_t file_bytes(uint64_t cap) { return kHeaderBytes + cap * sizeof(T); }
+
+  [[noreturn]] static void fail(const char* what) {
+    throw system_error(errno, generic_category(), what);
+  }
+
+  /**
+   * @brief Changes capacity: resize the file, then the mapping
+   *
+   * The file grows before the mapping does (touching pages past EOF would
+   * raise SIGBUS) and shrinks after it. The file is never smaller than
+   * file_bytes(header()->capacity) on disk, even if we crash in between:
+   * - grow:   file first, capacity written last
+   * - shrink: capacity written and synced first, file cut last
+   * A file left larger than its capacity is still accepted on reopen.
+   */
+  void resize(uint64_t newCap) {
+    size_t want = file_bytes(newCap);
+    if (want > mapped_ && ftruncate(fd_, static_cast<off_t>(want)) != 0) fail("ftruncate");
+    if (want < mapped_) {
+      header()->capacity = newCap;
+      if (msync(base_, kHeaderBytes, MS_SYNC) != 0) fail("msync");
+    }
+#ifdef __linux__
+    void* p = mremap(base_, mapped_, want, MREMAP_MAYMOVE);
+    if (p == MAP_FAILED) fail("mremap");
+#else
+    munmap(base_, mapped_);
+    void* p = mmap(nullptr, want, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (p == MAP_FAILED) fail("mmap");
+#endif
+    if (want < mapped_ && ftruncate(fd_, static_cast<off_t>(want)) != 0) fail("ftruncate");
+    base_ = p;
+    mapped_ = want;
+    header()->capacity = newCap;
+  }
+
+  public:
+  /**
+   * @brief Opens the array stored at path, creating it if it does not exist
+   * @param path File backing the array
+   * @param size Initial capacity for a new file (default: 10)
+   * @throws std::system_error on I/O failure
+   * @throws std::runtime_error if the file is not a compatible array
+   *
+   * Time Complexity: O(1) - reopening only maps the file and checks the header
+   */
+  explicit PersistentDynamicArray(const string& path, uint64_t size = 10)
+      : fd_(-1), base_(nullptr), mapped_(0) {
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd_ < 0) fail("open");
+    struct stat st;
+    if (fstat(fd_, &st) != 0) { ::close(fd_); fail("fstat"); }
+    bool fresh = st.st_size == 0;
+    mapped_ = fresh ? file_bytes(size < 1 ? 1 : size) : static_cast<size_t>(st.st_size);
+    if (fresh && ftruncate(fd_, static_cast<off_t>(mapped_)) != 0) { ::close(fd_); fail("ftruncate"); }
+    if (mapped_ < kHeaderBytes) { ::close(fd_); throw runtime_error("file too small: " + path); }
+    base_ = mmap(nullptr, mapped_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (base_ == MAP_FAILED) { ::close(fd_); fail("mmap"); }
+
+    Header* h = header();
+    if (fresh) {
+      *h = Header{kMagic, kVersion, static_cast<uint32_t>(sizeof(T)), 0, size < 1 ? 1 : size};
+      return;
+    }
+    // The file may be larger than its capacity after an interrupted resize
+    if (h->magic != kMagic || h->version != kVersion || h->elem_size != sizeof(T) ||
+        h->capacity > (mapped_ - kHeaderBytes) / sizeof(T) || h->size > h->capacity) {
+      munmap(base_, mapped_);
+      ::close(fd_);
+      throw runtime_error("not a compatible PersistentDynamicArray file: " + path);
+    }
+    size_t used = file_bytes(h->capacity);
+    if (used < mapped_) {   // Map only the capacity's bytes
+      munmap(base_, mapped_);
+      mapped_ = used;
+      base_ = mmap(nullptr, mapped_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+      if (base_ == MAP_FAILED) { base_ = nullptr; ::close(fd_); fail("mmap"); }
+    }
+  }
+
+  PersistentDynamicArray(const PersistentDynamicArray&) = delete;
+  PersistentDynamicArray& operator=(const PersistentDynamicArray&) = delete;
+
+  /**
+   * @brief Unmaps and closes; the file keeps the contents
+   */
+  ~PersistentDynamicArray() {
+    if (base_) munmap(base_, mapped_);
+    if (fd_ >= 0) ::close(fd_);
+  }
+
+  /**
+   * @brief Adds an element to the end, doubling the file when full
+   */
+  void append(const T& x) {
+    Header* h = header();
+    if (h->size == h->capacity) {
+      resize(h->capacity * 2);
+      h = header();
+    }
+    data()[h->size] = x;
+    ++h->size;
+  }
+
+  /**
+   * @brief Retrieves element at given index
+   * @throws std::out_of_range if index is invalid
+   */
+  T get(uint64_t i) const {
+    if (i >= header()->size) throw out_of_range("Index out of bounds");
+    return data()[i];
+  }
+
+  /**
+   * @brief Updates element at given index
+   * @throws std::out_of_range if index is invalid
+   */
+  void set(uint64_t i, const T& x) {
+    if (i >= header()->size) throw out_of_range("Index out of bounds");
+    data()[i] = x;
+  }
+
+  /**
+   * @brief Returns the current number of elements
+   */
+  size_t size() const { return static_cast<size_t>(header()->size); }
+
+  /**
+   * @brief Removes the last element; halves the file below 25% utilization
+   */
+  void pop_back() {
+    Header* h = header();
+    if (h->size == 0) return;
+    --h->size;
+    if (h->capacity > kMinCap && h->size * 4 < h->capacity) resize(h->capacity / 2);
+  }
+
+  /**
+   * @brief Flushes dirty pages and the header to disk (msync)
+   * @throws std::system_error on failure
+   */
+  void sync() {
+    if (msync(base_, mapped_, MS_SYNC) != 0) fail("msync");
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+using Clock = chrono::steady_clock;
+
+double ms_since(Clock::time_point t0) {
+  return chrono::duration<double, milli>(Clock::now() - t0).count();
+}
+
+int main(int argc, char* argv[]) {
+  string path = argc > 1 ? argv[1] : "/tmp/persistent_dynamic_array_demo.bin";
+  long long n = argc > 2 ? atoll(argv[2]) : 1000000;
+  if (n <= 0) {
+    cerr << "usage: " << argv[0] << " [path] [elements > 0]\n";
+    return 1;
+  }
+  remove(path.c_str());
+
+  // Example 1: Same API as dynamic_arrays1.cc
+  {
+    PersistentDynamicArray<int> d1(path);
+    d1.append(1);
+    d1.append(2);
+    d1.set(0, 10);
+    cout << d1.get(0) << "\n";    // returns 10
+    cout << d1.size() << "\n";    // returns 2
+    d1.pop_back();
+    cout << d1.size() << "\n";    // returns 1
+  }
+
+  // Example 2: Contents survive closing and reopening the file
+  {
+    PersistentDynamicArray<int> d2(path);
+    cout << d2.size() << " " << d2.get(0) << "\n";   // 1 10
+  }
+  remove(path.c_str());
+
+  // Example 3: Build once, then reopen (warm restart) without parsing
+  auto t0 = Clock::now();
+  {
+    PersistentDynamicArray<long long> d3(path);
+    for (long long i = 0; i < n; ++i) d3.append(i * i);
+    d3.sync();
+  }
+  double build_ms = ms_since(t0);
+
+  t0 = Clock::now();
+  PersistentDynamicArray<long long> d4(path);
+  double open_ms = ms_since(t0);
+  bool ok = d4.size() == static_cast<size_t>(n) && d4.get(n - 1) == (n - 1) * (n - 1);
+  cout << boolalpha << "build " << n << " elements: " << build_ms << "ms, reopen: "
+       << open_ms << "ms, contents intact: " << ok << "\n";
+
+  // Example 4: A file of another element type is rejected
+  try {
+    PersistentDynamicArray<int> wrong(path);
+  } catch (const runtime_error& e) {
+    cout << "rejected: " << e.what() << "\n";
+  }
+  if (argc <= 1) remove(path.c_str());
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why is reopening O(1)?
+ * - mmap only sets up page tables; no byte of the array is read until it
+ *   is accessed, and then the kernel serves it from the page cache.
+ *
+ * Durability:
+ * - MAP_SHARED writes reach the page cache immediately and survive a
+ *   process crash. Surviving a power loss requires sync() (msync).
+ * - The header's size is updated after the element is written, so a crash
+ *   between the two loses at most the last append.
+ *
+ * Portability:
+ * - The file stores raw bytes of T, so it is only valid on machines with
+ *   the same endianness and struct layout.
+ *
+ *============================================================================*/
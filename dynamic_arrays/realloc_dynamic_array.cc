@@ -0,0 +1,322 @@
+/**
+ * @file realloc_dynamic_array.cc
+ * @brief Dynamic Array with in-place growth via realloc/mremap
+ *
+ * The resize() in dynamic_arrays1.cc always allocates a new buffer, copies
+ * all size_ elements and frees the old one. For trivially copyable elements
+ * the copy is unnecessary when the memory system can extend a buffer itself:
+ *
+ * - Small buffers grow with realloc(), which extends the block in place
+ *   when the neighbouring heap memory is free
+ * - Page-sized and larger buffers live in an anonymous mmap() region and
+ *   grow with mremap(MREMAP_MAYMOVE); the kernel remaps the pages, so even
+ *   when the region moves no element is ever copied
+ *
+ * Key Concepts:
+ * - Storage backend as a template parameter (CopyStorage vs ReallocStorage)
+ * - Only legal for trivially copyable T (bytes can be moved by the system)
+ * - The single malloc -> mmap transition copies once, at one page
+ *
+ * Time Complexities:
+ * - append():   Amortized O(1); a resize costs O(pages) page-table updates
+ *               instead of O(n) element copies once the buffer is mapped
+ * - get()/set()/size(): O(1)
+ * - pop_back(): Amortized O(1)
+ *
+ * Space Complexity: O(n) where n is the number of elements
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include <sys/mman.h>
+#include <unistd.h>
+using namespace std;
+
+/*============================================================================
+ * STORAGE BACKENDS
+ *============================================================================*/
+
+/**
+ * A storage backend owns one buffer and exposes:
+ * - data():          pointer to the elements
+ * - resize(old, n):  change capacity to n slots, keeping the first old ones
+ */
+
+/**
+ * @class CopyStorage
+ * @brief The original strategy: new buffer, copy every element, free old one
+ */
+template <typename T>
+class CopyStorage {
+  T* data_ = nullptr;
+
+  public:
+  CopyStorage() = default;
+  CopyStorage(const CopyStorage&) = delete;
+  CopyStorage& operator=(const CopyStorage&) = delete;
+  ~CopyStorage() { delete[] data_; }
+
+  T* data() const { return data_; }
+
+  void resize(size_t keep, size_t newCap) {
+    T* temp = new T[newCap];
+    for (size_t i = 0; i < keep; ++i) temp[i] = data_[i];
+    delete[] data_;
+    data_ = temp;
+  }
+};
+
+/**
+ * @class ReallocStorage
+ * @brief realloc() below one page, mmap()/mremap() from one page upwards
+ *
+ * Mapped regions are always a whole number of pages; capacity is tracked in
+ * bytes so the region can be remapped to the exact rounded size.
+ */
+template <typename T>
+class ReallocStorage {
+  static_assert(is_trivially_copyable_v<T>,
+                "ReallocStorage moves raw bytes; T must be trivially copyable");
+
+  T* data_ = nullptr;   // Element buffer (malloc'ed or mapped)
+  size_t bytes_ = 0;    // Size of the buffer in bytes
+  bool mapped_ = false; // true once the buffer lives in an mmap region
+
+  static size_t page_size() {
+    static const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return page;
+  }
+
+  static size_t round_to_pages(size_t bytes) {
+    size_t page = page_size();
+    return (bytes + page - 1) / page * page;
+  }
+
+  static void* map(size_t bytes) {
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) throw bad_alloc();
+    return p;
+  }
+
+  void release() {
+    if (!data_) return;
+    if (mapped_) munmap(data_, bytes_);
+    else free(data_);
+  }
+
+  public:
+  ReallocStorage() = default;
+  ReallocStorage(const ReallocStorage&) = delete;
+  ReallocStorage& operator=(const ReallocStorage&) = delete;
+  ~ReallocStorage() { release(); }
+
+  T* data() const { return data_; }
+
+  /**
+   * @brief Whether the buffer is currently an mmap region (for reporting)
+   */
+  bool mapped() const { return mapped_; }
+
+  void resize(size_t keep, size_t newCap) {
+    size_t want = newCap * sizeof(T);
+    if (mapped_) {
+      // Already mapped: let the kernel move page-table entries, not data.
+      // Once mapped we stay mapped, even if the array shrinks below a page.
+      want = round_to_pages(want);
+      if (want == bytes_) return;
+#ifdef __linux__
+      void* p = mremap(data_, bytes_, want, MREMAP_MAYMOVE);
+      if (p == MAP_FAILED) throw bad_alloc();
+#else
+      void* p = map(want);
+      memcpy(p, data_, min(keep * sizeof(T), want));
+      munmap(data_, bytes_);
+#endif
+      data_ = static_cast<T*>(p);
+      bytes_ = want;
+    } else if (want >= page_size()) {
+      // One-time switch from the malloc heap to a private mapping
+      want = round_to_pages(want);
+      void* p = map(want);
+      if (keep) memcpy(p, data_, keep * sizeof(T));
+      free(data_);
+      data_ = static_cast<T*>(p);
+      bytes_ = want;
+      mapped_ = true;
+    } else {
+      void* p = realloc(data_, want);
+      if (!p) throw bad_alloc();
+      data_ = static_cast<T*>(p);
+      bytes_ = want;
+    }
+  }
+};
+
+/*============================================================================
+ * DYNAMIC ARRAY
+ *============================================================================*/
+
+/**
+ * @class DynamicArray
+ * @brief dynamic_arrays1.cc's array with a pluggable storage backend
+ * @tparam T       Element type
+ * @tparam Storage Buffer strategy (ReallocStorage or CopyStorage)
+ */
+template <typename T, typename Storage = ReallocStorage<T>>
+class DynamicArray {
+  Storage store_;   // Owns the underlying buffer
+  size_t cap_;      // Current capacity (total allocated slots)
+  size_t size_;     // Current number of elements stored
+
+  /**
+   * @brief Resizes the storage to a new capacity
+   *
+   * Time Complexity: O(n) for CopyStorage, O(pages) for mapped storage
+   */
+  void resize(size_t newCap) {
+    store_.resize(size_, newCap);
+    cap_ = newCap;
+  }
+
+  public:
+  /**
+   * @brief Constructor - creates a dynamic array with initial capacity
+   * @param size Initial capacity (default: 10)
+   */
+  explicit DynamicArray(size_t size = 10) : cap_(size < 1 ? 1 : size), size_(0) {
+    store_.resize(0, cap_);
+  }
+
+  /**
+   * @brief Adds an element to the end, doubling capacity when full
+   */
+  void append(const T& x) {
+    store_.data()[size_] = x;
+    ++size_;
+    if (size_ == cap_) resize(cap_ * 2);
+  }
+
+  /**
+   * @brief Retrieves element at given index
+   * @throws std::out_of_range if index is invalid
+   */
+  T get(size_t i) const {
+    if (i >= size_) throw out_of_range("Index out of bounds");
+    return store_.data()[i];
+  }
+
+  /**
+   * @brief Updates element at given index
+   * @throws std::out_of_range if index is invalid
+   */
+  void set(size_t i, const T& x) {
+    if (i >= size_) throw out_of_range("Index out of bounds");
+    store_.data()[i] = x;
+  }
+
+  /**
+   * @brief Returns the current number of elements
+   */
+  size_t size() const { return size_; }
+
+  /**
+   * @brief Read-only access to the storage backend (for reporting)
+   */
+  const Storage& storage() const { return store_; }
+
+  /**
+   * @brief Removes the last element, halving capacity below 25% utilization
+   */
+  void pop_back() {
+    if (size_ == 0) return;
+    --size_;
+    if (cap_ > 10 && size_ * 4 < cap_) resize(cap_ / 2);
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+/**
+ * @brief Times every append of n ints and prints latency percentiles
+ *
+ * Only ~log2(n) appends trigger a resize, so the spikes show up in the
+ * p99.99 and max columns; p99 reflects the common non-resizing append.
+ */
+template <typename Storage>
+void append_latency(const char* name, size_t n) {
+  using Clock = chrono::steady_clock;
+  vector<long long> ns(n);
+  DynamicArray<int, Storage> d;
+  for (size_t i = 0; i < n; ++i) {
+    auto t0 = Clock::now();
+    d.append(static_cast<int>(i));
+    auto t1 = Clock::now();
+    ns[i] = chrono::duration_cast<chrono::nanoseconds>(t1 - t0).count();
+  }
+  long long total = 0;
+  for (long long v : ns) total += v;
+  sort(ns.begin(), ns.end());
+  auto pct = [&](double p) { return ns[min(n - 1, static_cast<size_t>(p * n))]; };
+  cout << name << " n=" << n << "  p50=" << pct(0.50) << "ns  p99=" << pct(0.99)
+       << "ns  p99.99=" << pct(0.9999) << "ns  max=" << ns[n - 1]
+       << "ns  total=" << total / 1000000.0 << "ms\n";
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: Same behaviour as dynamic_arrays1.cc
+  DynamicArray<int> d1;
+  d1.append(1);
+  d1.append(2);
+  cout << d1.get(0) << "\n";   // returns 1
+  cout << d1.get(1) << "\n";   // returns 2
+  cout << d1.size() << "\n";   // returns 2
+  d1.set(0, 10);
+  d1.pop_back();
+  cout << d1.get(0) << " " << d1.size() << "\n";  // 10 1
+
+  // Example 2: Growing past one page switches to an mmap region
+  DynamicArray<long long> d2;
+  for (int i = 0; i < 100000; ++i) d2.append(i);
+  cout << boolalpha << d2.storage().mapped() << " " << d2.get(99999) << "\n";
+  while (d2.size() > 5) d2.pop_back();                 // shrinks via mremap
+  cout << d2.get(4) << " " << d2.size() << "\n";       // 4 5
+
+  // Example 3: Append latency before (copy) and after (realloc/mremap)
+  size_t n = argc > 1 ? strtoull(argv[1], nullptr, 10) : 1000000;
+  if (n == 0) {
+    cerr << "usage: " << argv[0] << " [appends > 0]\n";
+    return 1;
+  }
+  append_latency<CopyStorage<int>>("before: CopyStorage   ", n);
+  append_latency<ReallocStorage<int>>("after:  ReallocStorage", n);
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why only trivially copyable types?
+ * - realloc/mremap move bytes without running constructors. That is only
+ *   a valid relocation when T has no custom copy/move/destroy logic.
+ *
+ * Why a page threshold?
+ * - mmap works in whole pages, so tiny arrays would waste most of a page.
+ *   Below one page realloc is cheap and often extends in place anyway.
+ *
+ * Why does mremap never copy?
+ * - The kernel either extends the mapping into free address space or
+ *   moves the page-table entries to a new virtual range. Physical pages
+ *   stay where they are, so the cost depends on page count, not data.
+ *
+ *============================================================================*/
@@ -0,0 +1,356 @@
+/**
+ * @file small_dynamic_array.cc
+ * @brief Small-buffer-optimized Dynamic Array (SmallDynamicArray<T, N>)
+ *
+ * DynamicArray(int size=10) in dynamic_arrays1.cc calls new int[cap_] even
+ * when the array never holds more than a handful of elements. For many short
+ * arrays the allocator calls cost more than the elements themselves.
+ *
+ * SmallDynamicArray<T, N> reserves room for N elements inside the object:
+ *
+ *   object (inline mode)                object (heap mode, size > N)
+ *   ┌──────┬──────┬───────────────┐     ┌──────┬──────┬───────────────┐
+ *   │ data_│ size_│ inline_[N]    │     │ data_│ size_│ (unused)      │
+ *   │  *───────────→ [a b c _ _] │     │  *──────→ heap [a b ... z _ _]
+ *   └──────┴──────┴───────────────┘     └──────┴──────┴───────────────┘
+ *
+ * Key Concepts:
+ * - No allocation at all while size <= N
+ * - On overflow, elements move to a heap buffer that then grows by doubling
+ * - A heap buffer halves when less than 1/4 full; once that would make it
+ *   N slots or fewer (size < N/2 after the first spill), the elements
+ *   return to the inline buffer and the heap block is freed. The gap
+ *   between N and N/2 keeps append/pop_back at the boundary from
+ *   allocating and freeing on every call
+ * - Same API as dynamic_arrays2.cc
+ *
+ * Time Complexities:
+ * - append():             Amortized O(1), no allocation while size <= N
+ * - get()/set()/size():   O(1)
+ * - pop_back():           Amortized O(1)
+ * - pop(i)/insert(i, x):  O(n) - shifting
+ * - contains()/remove():  O(n) - linear search
+ *
+ * Space Complexity: O(N) inside the object + O(n) on the heap if n > N
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+using namespace std;
+
+/*============================================================================
+ * ALLOCATION INSTRUMENTATION
+ *============================================================================*/
+
+/**
+ * Replacing the global operator new/delete lets the demo count every heap
+ * allocation made by either array (new[] forwards to these by default).
+ */
+static size_t g_allocations = 0;
+static size_t g_bytes_allocated = 0;
+
+void* operator new(size_t bytes) {
+  ++g_allocations;
+  g_bytes_allocated += bytes;
+  if (void* p = malloc(bytes ? bytes : 1)) return p;
+  throw bad_alloc();
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t) noexcept { free(p); }
+
+/*============================================================================
+ * SMALL DYNAMIC ARRAY
+ *============================================================================*/
+
+/**
+ * @class SmallDynamicArray
+ * @brief Dynamic array with inline storage for the first N elements
+ * @tparam T Element type
+ * @tparam N Number of elements stored inside the object
+ */
+template <typename T, size_t N = 16>
+class SmallDynamicArray {
+  static_assert(N > 0, "N must be positive");
+
+  T* data_;                                   // inline_ or a heap buffer
+  size_t size_;                               // Number of elements stored
+  size_t cap_;                                // N while inline
+  alignas(T) unsigned char inline_[N * sizeof(T)];
+
+  T* inline_data() { return reinterpret_cast<T*>(inline_); }
+  bool is_inline() const { return data_ == reinterpret_cast<const T*>(inline_); }
+
+  /**
+   * @brief Moves n elements from src to uninitialized dst, destroying src
+   */
+  static void relocate(T* src, size_t n, T* dst) {
+    if constexpr (is_trivially_copyable_v<T>) {
+      if (n) memcpy(static_cast<void*>(dst), src, n * sizeof(T));
+    } else {
+      for (size_t i = 0; i < n; ++i) {
+        ::new (dst + i) T(move(src[i]));
+        src[i].~T();
+      }
+    }
+  }
+
+  /**
+   * @brief Moves the elements to a buffer of newCap slots
+   *
+   * newCap <= N means "go back to the inline buffer".
+   */
+  void resize(size_t newCap) {
+    T* temp = newCap <= N ? inline_data()
+                          : static_cast<T*>(::operator new(newCap * sizeof(T)));
+    if (temp == data_) return;
+    relocate(data_, size_, temp);
+    if (!is_inline()) ::operator delete(data_);
+    data_ = temp;
+    cap_ = newCap <= N ? N : newCap;
+  }
+
+  /**
+   * @brief Halves a heap buffer below 1/4 full; resize() goes inline once
+   *        the halved capacity is <= N
+   */
+  void shrink_if_sparse() {
+    if (is_inline()) return;
+    if (size_ * 4 < cap_) resize(cap_ / 2);
+  }
+
+  void check_index(size_t i) const {
+    if (i >= size_) throw out_of_range("Index out of bounds");
+  }
+
+  void destroy_all() {
+    for (size_t i = 0; i < size_; ++i) data_[i].~T();
+    if (!is_inline()) ::operator delete(data_);
+  }
+
+  /**
+   * @brief Takes other's elements; *this must be empty and inline
+   */
+  void steal(SmallDynamicArray& other) {
+    if (other.is_inline()) {
+      relocate(other.data_, other.size_, data_);
+    } else {
+      data_ = other.data_;
+      cap_ = other.cap_;
+      other.data_ = other.inline_data();
+      other.cap_ = N;
+    }
+    size_ = other.size_;
+    other.size_ = 0;
+  }
+
+  public:
+  /**
+   * @brief Constructor - empty array using the inline buffer, no allocation
+   */
+  SmallDynamicArray() : data_(inline_data()), size_(0), cap_(N) {}
+
+  SmallDynamicArray(const SmallDynamicArray& other) : SmallDynamicArray() {
+    if (other.size_ > N) resize(other.cap_);
+    for (; size_ < other.size_; ++size_) ::new (data_ + size_) T(other.data_[size_]);
+  }
+
+  /**
+   * @brief Move constructor - steals a heap buffer, moves inline elements
+   */
+  SmallDynamicArray(SmallDynamicArray&& other) noexcept : SmallDynamicArray() {
+    steal(other);
+  }
+
+  SmallDynamicArray& operator=(SmallDynamicArray other) noexcept {
+    destroy_all();
+    data_ = inline_data();
+    cap_ = N;
+    size_ = 0;
+    steal(other);
+    return *this;
+  }
+
+  ~SmallDynamicArray() { destroy_all(); }
+
+  /**
+   * @brief Adds an element to the end; allocates only past N elements
+   */
+  void append(T x) {
+    if (size_ == cap_) resize(cap_ * 2);
+    ::new (data_ + size_) T(move(x));
+    ++size_;
+  }
+
+  const T& get(size_t i) const { check_index(i); return data_[i]; }
+  void set(size_t i, T x) { check_index(i); data_[i] = move(x); }
+  size_t size() const { return size_; }
+
+  /**
+   * @brief Whether the elements currently live inside the object
+   */
+  bool uses_inline() const { return is_inline(); }
+
+  void pop_back() {
+    if (size_ == 0) return;
+    data_[--size_].~T();
+    shrink_if_sparse();
+  }
+
+  T pop(size_t index) {
+    check_index(index);
+    T val = move(data_[index]);
+    for (size_t i = index; i + 1 < size_; ++i) data_[i] = move(data_[i + 1]);
+    data_[--size_].~T();
+    shrink_if_sparse();
+    return val;
+  }
+
+  bool contains(const T& x) const {
+    for (size_t i = 0; i < size_; ++i)
+      if (data_[i] == x) return true;
+    return false;
+  }
+
+  void insert(size_t index, T x) {
+    if (index > size_) throw out_of_range("Index out of bounds");
+    if (size_ == cap_) resize(cap_ * 2);
+    if (index == size_) {
+      ::new (data_ + size_) T(move(x));
+    } else {
+      ::new (data_ + size_) T(move(data_[size_ - 1]));
+      for (size_t i = size_ - 1; i > index; --i) data_[i] = move(data_[i - 1]);
+      data_[index] = move(x);
+    }
+    ++size_;
+  }
+
+  long long remove(const T& x) {
+    for (size_t i = 0; i < size_; ++i) {
+      if (data_[i] == x) {
+        pop(i);
+        return static_cast<long long>(i);
+      }
+    }
+    return -1;
+  }
+};
+
+/*============================================================================
+ * BASELINE - DynamicArray from dynamic_arrays1.cc
+ *============================================================================*/
+
+class DynamicArray {
+  int cap_;
+  int* arr_;
+  int size_;
+
+  void resize(int newCap) {
+    int* temp = new int[newCap];
+    for(int i=0;i<size_;++i) temp[i] = arr_[i];
+    delete [] arr_;
+    arr_ = temp;
+    cap_ = newCap;
+  }
+
+  public:
+  DynamicArray(int size=10) : cap_(size), arr_(new int[cap_]), size_(0) {}
+  ~DynamicArray() {delete [] arr_;}
+  DynamicArray(const DynamicArray&) = delete;
+  DynamicArray& operator=(const DynamicArray&) = delete;
+
+  void append(int x) {
+    arr_[size_] = x;
+    ++size_;
+    if(size_==cap_) resize(cap_*2);
+  }
+  size_t size() { return static_cast<size_t>(size_); }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+/**
+ * @brief Builds `count` arrays of `len` ints and reports heap allocations
+ */
+template <typename Array>
+void count_allocations(const char* name, int count, int len) {
+  size_t a0 = g_allocations, b0 = g_bytes_allocated;
+  long long checksum = 0;
+  for (int c = 0; c < count; ++c) {
+    Array d;
+    for (int i = 0; i < len; ++i) d.append(i);
+    checksum += d.size();
+  }
+  cout << name << " len=" << len << ": " << g_allocations - a0 << " allocations, "
+       << g_bytes_allocated - b0 << " bytes (checksum " << checksum << ")\n";
+}
+
+int main() {
+  // Example 1: Same API as dynamic_arrays2.cc
+  SmallDynamicArray<int, 4> d1;
+  d1.append(1);
+  d1.append(2);
+  d1.append(3);
+  cout << d1.pop(1) << "\n";       // returns 2
+  cout << d1.get(1) << "\n";       // returns 3
+  cout << boolalpha << d1.contains(1) << "\n";  // true
+  d1.insert(1, 7);                 // [1, 7, 3]
+  cout << d1.remove(3) << "\n";    // returns 2
+  cout << d1.uses_inline() << "\n";   // true - still inline
+
+  // Example 2: Overflow to the heap and back
+  size_t before = g_allocations;
+  for (int i = 0; i < 10; ++i) d1.append(i);
+  cout << d1.uses_inline() << " " << d1.size() << "\n";   // false 12
+  while (d1.size() > 3) d1.pop_back();
+  cout << d1.uses_inline() << "\n";   // false - 3 is not below N/2 = 2
+  while (d1.size() > 1) d1.pop_back();
+  cout << d1.uses_inline() << " " << g_allocations - before << "\n";  // true 3
+
+  // Alternating append/pop_back across N <-> N+1 allocates once, not per call
+  before = g_allocations;
+  for (int i = 0; i < 3; ++i) d1.append(i);       // size 4 = N
+  for (int i = 0; i < 1000; ++i) { d1.append(i); d1.pop_back(); }
+  cout << g_allocations - before << "\n";         // 1
+
+  // Example 3: Non-trivial element type
+  SmallDynamicArray<string, 2> titles;
+  titles.append("Hey Queue");
+  titles.append("Merge Together");
+  titles.append("Dirty Data");          // spills to the heap
+  SmallDynamicArray<string, 2> moved(move(titles));
+  cout << moved.get(2) << " " << titles.size() << "\n";  // Dirty Data 0
+
+  // Example 4: Allocation counts for 100000 short arrays
+  for (int len : {4, 12, 40}) {
+    count_allocations<DynamicArray>("DynamicArray           ", 100000, len);
+    count_allocations<SmallDynamicArray<int, 16>>("SmallDynamicArray<int,16>", 100000, len);
+  }
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Choosing N:
+ * - Large enough to cover the common case (here: < 16 elements), small
+ *   enough that sizeof(SmallDynamicArray) stays cache friendly. Every
+ *   object pays N * sizeof(T) bytes even when empty.
+ *
+ * Why can't the move constructor always steal?
+ * - Inline elements live inside the source object, so they have to be moved
+ *   one by one. Only heap buffers can be handed over in O(1).
+ *
+ * Iterator/pointer stability:
+ * - Crossing the N boundary in either direction relocates every element.
+ *
+ *============================================================================*/
@@ -0,0 +1,411 @@
+/**
+ * @file sorted_dynamic_array.cc
+ * @brief Sorted Dynamic Array with branchless binary search and bulk merge
+ *
+ * dynamic_arrays2.cc keeps no order, so contains() is a linear scan. When
+ * the elements are kept sorted every lookup becomes a binary search, and a
+ * batch of insertions can be merged in a single pass.
+ *
+ * Key Concepts:
+ * - Branchless lower_bound: the loop always runs ceil(log2 n) iterations and
+ *   the comparison result selects the next base with a conditional move,
+ *   so there are no unpredictable branches to mispredict
+ * - insert_many(): sort the batch, grow once, then merge from the back into
+ *   the same buffer (like merging two sorted arrays in place) - every old
+ *   element moves at most once instead of once per inserted element
+ *
+ * Time Complexities:
+ * - lower_bound()/upper_bound()/contains()/count(): O(log n)
+ * - insert(x):              O(n) - binary search + shift
+ * - insert_many(k values):  O(k log k + n + k) instead of O(k * n)
+ * - pop(i)/remove(x):       O(n) - shift (remove finds x in O(log n))
+ * - get()/size():           O(1)
+ *
+ * Space Complexity: O(n) where n is the number of elements
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+/**
+ * @class SortedDynamicArray
+ * @brief Dynamic array whose elements are always in non-decreasing order
+ *
+ * There is no set(i, x) or insert(i, x): the position of an element is
+ * decided by its value.
+ */
+class SortedDynamicArray {
+  private:
+    int cap_;    // Current capacity (total allocated space)
+    int* arr_;   // Pointer to the underlying fixed-size array
+    int size_;   // Current number of elements stored
+
+    void resize(int newCap);
+
+  public:
+    SortedDynamicArray(int size=10);
+    ~SortedDynamicArray();
+    SortedDynamicArray(const SortedDynamicArray&) = delete;
+    SortedDynamicArray& operator=(const SortedDynamicArray&) = delete;
+
+    int get(int i);
+    size_t size();
+
+    /**
+     * @brief Index of the first element >= x (size() if none)
+     *
+     * Time Complexity: O(log n), branchless
+     */
+    int lower_bound(int x);
+
+    /**
+     * @brief Index of the first element > x (size() if none)
+     *
+     * Time Complexity: O(log n), branchless
+     */
+    int upper_bound(int x);
+
+    /**
+     * @brief Checks if element exists - O(log n)
+     */
+    bool contains(int x);
+
+    /**
+     * @brief Number of elements equal to x - O(log n)
+     */
+    int count(int x);
+
+    /**
+     * @brief Inserts x at its sorted position (after equal elements)
+     * @return Index where x was placed
+     *
+     * Time Complexity: O(n) - shifts larger elements right
+     */
+    int insert(int x);
+
+    /**
+     * @brief Inserts a whole batch with one sort and one merge pass
+     * @param first, last Range of values to insert (any order)
+     *
+     * Time Complexity: O(k log k + n + k) for k values
+     */
+    template <typename It>
+    void insert_many(It first, It last);
+    void insert_many(const vector<int>& batch) { insert_many(batch.begin(), batch.end()); }
+
+    void pop_back();
+    int pop(int i);
+
+    /**
+     * @brief Removes first occurrence of x
+     * @return Index where element was found, or -1 if not found
+     */
+    int remove(int x);
+};
+
+/*============================================================================
+ * IMPLEMENTATION SECTION
+ *============================================================================*/
+
+SortedDynamicArray::SortedDynamicArray(int size)
+    : cap_(size < 1 ? 1 : size), arr_(new int[cap_]), size_(0) {}
+
+SortedDynamicArray::~SortedDynamicArray() {delete [] arr_;}
+
+void SortedDynamicArray::resize(int newCap) {
+  int* temp = new int[newCap];
+  for(int i=0;i<size_;++i) temp[i] = arr_[i];
+  delete [] arr_;
+  arr_ = temp;
+  cap_ = newCap;
+}
+
+int SortedDynamicArray::get(int i) {
+  if (i < 0 || i >= size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  return arr_[i];
+}
+
+size_t SortedDynamicArray::size() {
+  return static_cast<size_t>(size_);
+}
+
+/**
+ * lower_bound() - branchless binary search
+ *
+ * Invariant: the answer lies in [base, base + len]. Each step compares the
+ * last element of the lower half and advances base by `half` or 0; the
+ * compiler turns the ternary into a conditional move.
+ *
+ * Example: [1, 3, 3, 5, 8], x = 3
+ *   len=5 half=2: base[1]=3 <  3? no  -> base=0, len=3
+ *   len=3 half=1: base[0]=1 <  3? yes -> base=1, len=2
+ *   len=2 half=1: base[0]=3 <  3? no  -> base=1, len=1
+ *   result = 1 + (arr[1] < 3) = 1
+ */
+int SortedDynamicArray::lower_bound(int x) {
+  if(size_==0) return 0;
+  const int* base = arr_;
+  int len = size_;
+  while(len>1) {
+    int half = len/2;
+    base = (base[half-1] < x) ? base+half : base;
+    len -= half;
+  }
+  return static_cast<int>(base-arr_) + (*base < x);
+}
+
+/**
+ * upper_bound() - same loop with <= so equal elements are skipped
+ */
+int SortedDynamicArray::upper_bound(int x) {
+  if(size_==0) return 0;
+  const int* base = arr_;
+  int len = size_;
+  while(len>1) {
+    int half = len/2;
+    base = (base[half-1] <= x) ? base+half : base;
+    len -= half;
+  }
+  return static_cast<int>(base-arr_) + (*base <= x);
+}
+
+bool SortedDynamicArray::contains(int x) {
+  int i = lower_bound(x);
+  return i<size_ && arr_[i]==x;
+}
+
+int SortedDynamicArray::count(int x) {
+  return upper_bound(x)-lower_bound(x);
+}
+
+int SortedDynamicArray::insert(int x) {
+  if(size_+1>=cap_) {
+    resize(cap_*2);
+  }
+  int index = upper_bound(x);
+  for(int i=size_;i>index;--i) {
+    arr_[i] = arr_[i-1];
+  }
+  arr_[index] = x;
+  size_++;
+  return index;
+}
+
+/**
+ * insert_many() - sort the batch, then merge from the back
+ *
+ * Algorithm:
+ * 1. Copy and sort the batch: O(k log k)
+ * 2. Grow the buffer once to fit size + k (doubling as append would)
+ * 3. Walk both sorted sequences from their largest element, writing the
+ *    larger one to the end of the combined range. The write position is
+ *    always >= the read position in arr_, so nothing is overwritten early.
+ *
+ *    arr_  = [1, 4, 9, _, _]   batch = [2, 7]
+ *    write 9 -> [1, 4, 9, _, 9]
+ *    write 7 -> [1, 4, 9, 7, 9]
+ *    write 4 -> [1, 4, 4, 7, 9]
+ *    write 2 -> [1, 2, 4, 7, 9]   (1 is already in place)
+ */
+template <typename It>
+void SortedDynamicArray::insert_many(It first, It last) {
+  vector<int> batch(first, last);
+  if(batch.empty()) return;
+  sort(batch.begin(), batch.end());
+  int k = static_cast<int>(batch.size());
+  if(size_+k>=cap_) {
+    int newCap = cap_;
+    while(size_+k>=newCap) newCap *= 2;
+    resize(newCap);
+  }
+  int i = size_-1;        // Last unmerged old element
+  int j = k-1;            // Last unmerged batch element
+  int w = size_+k-1;      // Next write position
+  while(j>=0) {
+    // Ties take the batch element first, so equal old elements stay in front
+    if(i>=0 && arr_[i]>batch[j]) arr_[w--] = arr_[i--];
+    else arr_[w--] = batch[j--];
+  }
+  size_ += k;
+}
+
+void SortedDynamicArray::pop_back() {
+  if(size_==0) return;
+  size_--;
+  if(cap_>10 && (static_cast<double>(size_)/cap_)<0.25) {
+    resize(cap_/2);
+  }
+}
+
+int SortedDynamicArray::pop(int index) {
+  if (index < 0 || index >= size_) {
+    throw std::out_of_range("Index out of bounds");
+  }
+  int val = arr_[index];
+  for(int i=index;i<size_-1;++i) {
+    arr_[i] = arr_[i+1];
+  }
+  size_--;
+  if(cap_>10 && (static_cast<double>(size_)/cap_)<0.25) {
+    resize(cap_/2);
+  }
+  return val;
+}
+
+int SortedDynamicArray::remove(int x) {
+  int index = lower_bound(x);
+  if(index==size_ || arr_[index]!=x) return -1;
+  pop(index);
+  return index;
+}
+
+/*============================================================================
+ * BENCHMARK BASELINE - DynamicArray from dynamic_arrays2.cc
+ *============================================================================*/
+
+/**
+ * @class DynamicArray
+ * @brief The unordered array; kept sorted by the caller via insert(i, x)
+ */
+class DynamicArray {
+  int cap_;
+  int* arr_;
+  int size_;
+
+  void resize(int newCap) {
+    int* temp = new int[newCap];
+    for(int i=0;i<size_;++i) temp[i] = arr_[i];
+    delete [] arr_;
+    arr_ = temp;
+    cap_ = newCap;
+  }
+
+  public:
+  DynamicArray(int size=10) : cap_(size), arr_(new int[cap_]), size_(0) {}
+  ~DynamicArray() {delete [] arr_;}
+  DynamicArray(const DynamicArray&) = delete;
+  DynamicArray& operator=(const DynamicArray&) = delete;
+
+  int get(int i) { return arr_[i]; }
+  size_t size() { return static_cast<size_t>(size_); }
+
+  void insert(int index, int x) {
+    if(size_+1==cap_) resize(cap_*2);
+    for(int i=size_;i>index;--i) arr_[i] = arr_[i-1];
+    size_++;
+    arr_[index] = x;
+  }
+
+  bool contains(int x) {
+    for(int i=0;i<size_;++i) if(arr_[i]==x) return true;
+    return false;
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+using Clock = chrono::steady_clock;
+
+double ms_since(Clock::time_point t0) {
+  return chrono::duration<double, milli>(Clock::now() - t0).count();
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: Ordered queries
+  SortedDynamicArray s1;
+  for (int x : {5, 1, 3, 8, 3}) s1.insert(x);   // [1, 3, 3, 5, 8]
+  cout << boolalpha;
+  cout << s1.contains(3) << "\n";       // true
+  cout << s1.contains(4) << "\n";       // false
+  cout << s1.lower_bound(3) << "\n";    // 1
+  cout << s1.upper_bound(3) << "\n";    // 3
+  cout << s1.count(3) << "\n";          // 2
+  cout << s1.remove(3) << "\n";         // 1
+  s1.insert_many({7, 0, 3, 9});         // [0, 1, 3, 3, 5, 7, 8, 9]
+  for (size_t i = 0; i < s1.size(); ++i) cout << s1.get(i) << " ";
+  cout << "\n";
+
+  // Example 2: Bulk merge vs repeated insert() on dynamic_arrays2.cc's array
+  int n = argc > 1 ? atoi(argv[1]) : 100000;   // existing elements
+  int k = argc > 2 ? atoi(argv[2]) : 20000;    // batch size
+  if (n < 0 || k <= 0) {
+    cerr << "usage: " << argv[0] << " [existing >= 0] [batch size > 0]\n";
+    return 1;
+  }
+  mt19937 rng(3);
+  vector<int> base(n), batch(k);
+  for (int& x : base) x = static_cast<int>(rng());
+  for (int& x : batch) x = static_cast<int>(rng());
+
+  DynamicArray plain;
+  SortedDynamicArray sorted_one, sorted_bulk;
+  sort(base.begin(), base.end());
+  for (int i = 0; i < n; ++i) plain.insert(i, base[i]);
+  sorted_one.insert_many(base);
+  sorted_bulk.insert_many(base);
+
+  auto t0 = Clock::now();
+  for (int x : batch) {
+    int lo = 0, hi = static_cast<int>(plain.size());   // caller finds the slot
+    while (lo < hi) {
+      int mid = (lo + hi) / 2;
+      if (plain.get(mid) <= x) lo = mid + 1; else hi = mid;
+    }
+    plain.insert(lo, x);
+  }
+  double plain_ms = ms_since(t0);
+
+  t0 = Clock::now();
+  for (int x : batch) sorted_one.insert(x);
+  double one_ms = ms_since(t0);
+
+  t0 = Clock::now();
+  sorted_bulk.insert_many(batch);
+  double bulk_ms = ms_since(t0);
+
+  bool same = true;
+  for (size_t i = 0; i < plain.size(); ++i)
+    same = same && plain.get(i) == sorted_bulk.get(i) && sorted_one.get(i) == sorted_bulk.get(i);
+  cout << "insert " << k << " into " << n << ": DynamicArray::insert " << plain_ms
+       << "ms, SortedDynamicArray::insert " << one_ms << "ms, insert_many "
+       << bulk_ms << "ms (same result: " << same << ")\n";
+
+  // Example 3: contains() - linear scan vs branchless binary search
+  int q = 2000, hits = 0;
+  t0 = Clock::now();
+  for (int r = 0; r < q; ++r) hits += plain.contains(batch[r % k] + (r & 1));
+  double scan_ms = ms_since(t0);
+  t0 = Clock::now();
+  for (int r = 0; r < q; ++r) hits -= sorted_bulk.contains(batch[r % k] + (r & 1));
+  double bs_ms = ms_since(t0);
+  cout << q << " contains(): linear " << scan_ms << "ms, binary " << bs_ms
+       << "ms (hit diff " << hits << ")\n";
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why branchless?
+ * - In a classic binary search the "go left or right" branch is taken with
+ *   probability 1/2, so the CPU mispredicts about half of them (~15 cycles
+ *   each). A fixed trip count plus conditional move has no such stalls and
+ *   lets the CPU run ahead to the next load.
+ *
+ * Why merge from the back?
+ * - The free capacity is at the end of the buffer. Filling it from the
+ *   largest element down never overwrites an old element that has not been
+ *   read yet, so no temporary copy of the array is needed.
+ *
+ *============================================================================*/
@@ -0,0 +1,418 @@
+/**
+ * @file tiered_vector.cc
+ * @brief Tiered Vector: O(1) access with O(sqrt n) insert/pop at any index
+ *
+ * dynamic_arrays2.cc shifts every later element on insert(i, x) and pop(i),
+ * so both are O(n). A tiered vector splits the array into blocks of B slots,
+ * each block being a small circular buffer:
+ *
+ *   block 0          block 1          block 2 (last, may be partial)
+ *   [ d e | a b c ]  [ f g h i j ]    [ k l _ _ _ ]
+ *       ^ head           ^ head         ^ head
+ *
+ * Every block except the last is exactly full, so element i lives in block
+ * i / B at offset i % B and random access stays O(1).
+ *
+ * Key Concepts:
+ * - insert(i, x): shift inside one block (O(B)), then every later block
+ *   passes its last element to the next block's front (O(1) each thanks to
+ *   the circular layout) - O(B + n/B) total
+ * - pop(i): mirror image - shift inside one block, then every later block
+ *   passes its first element to the previous block's back
+ * - B is a power of two kept near sqrt(n); the structure is rebuilt when n
+ *   leaves [B^2/16, 4B^2], which costs O(n) but happens O(log n) times
+ *
+ * Time Complexities:
+ * - get()/set()/size():  O(1)
+ * - append()/pop_back(): O(1) amortized
+ * - insert()/pop():      O(sqrt n)
+ * - contains()/remove(): O(n) - linear search (+ O(sqrt n) removal)
+ *
+ * Space Complexity: O(n + sqrt n)
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+using namespace std;
+
+/**
+ * @class TieredVector
+ * @brief Array of circular blocks with the dynamic_arrays2.cc API
+ * @tparam T Element type (must be default constructible and movable)
+ */
+template <typename T>
+class TieredVector {
+  static constexpr size_t kMinBlock = 64;
+
+  /**
+   * @struct Block
+   * @brief Fixed-capacity circular buffer of B slots
+   */
+  struct Block {
+    unique_ptr<T[]> data;   // B slots
+    size_t head = 0;        // Physical index of logical element 0
+    size_t count = 0;       // Number of elements in the block
+    explicit Block(size_t B) : data(new T[B]) {}
+  };
+
+  size_t B_;              // Block size (power of two)
+  size_t mask_;           // B_ - 1, for cheap modulo
+  vector<Block> blocks_;  // All full except possibly the last
+  size_t size_;           // Total number of elements
+
+  T& at(Block& b, size_t k) { return b.data[(b.head + k) & mask_]; }
+  const T& at(const Block& b, size_t k) const { return b.data[(b.head + k) & mask_]; }
+
+  void push_front(Block& b, T x) {
+    b.head = (b.head - 1) & mask_;
+    b.data[b.head] = move(x);
+    ++b.count;
+  }
+
+  T pop_back(Block& b) {
+    --b.count;
+    return move(at(b, b.count));
+  }
+
+  void push_back(Block& b, T x) {
+    at(b, b.count) = move(x);
+    ++b.count;
+  }
+
+  T pop_front(Block& b) {
+    T x = move(b.data[b.head]);
+    b.head = (b.head + 1) & mask_;
+    --b.count;
+    return x;
+  }
+
+  /**
+   * @brief Inserts x at offset k of a non-full block, moving the shorter side
+   */
+  void insert_in_block(Block& b, size_t k, T x) {
+    if (k < b.count / 2) {
+      b.head = (b.head - 1) & mask_;
+      for (size_t j = 0; j < k; ++j) at(b, j) = move(at(b, j + 1));
+    } else {
+      for (size_t j = b.count; j > k; --j) at(b, j) = move(at(b, j - 1));
+    }
+    at(b, k) = move(x);
+    ++b.count;
+  }
+
+  /**
+   * @brief Removes and returns offset k of a block, moving the shorter side
+   */
+  T erase_in_block(Block& b, size_t k) {
+    T val = move(at(b, k));
+    if (k < b.count / 2) {
+      for (size_t j = k; j > 0; --j) at(b, j) = move(at(b, j - 1));
+      b.head = (b.head + 1) & mask_;
+    } else {
+      for (size_t j = k; j + 1 < b.count; ++j) at(b, j) = move(at(b, j + 1));
+    }
+    --b.count;
+    return val;
+  }
+
+  /**
+   * @brief Redistributes all elements into blocks of size newB
+   *
+   * Time Complexity: O(n)
+   */
+  void rebuild(size_t newB) {
+    vector<Block> old = move(blocks_);
+    size_t oldMask = mask_;
+    B_ = newB;
+    mask_ = newB - 1;
+    blocks_.clear();
+    for (Block& b : old) {
+      for (size_t k = 0; k < b.count; ++k) {
+        if (blocks_.empty() || blocks_.back().count == B_) blocks_.emplace_back(B_);
+        push_back(blocks_.back(), move(b.data[(b.head + k) & oldMask]));
+      }
+    }
+  }
+
+  /**
+   * @brief Keeps B near sqrt(n) after size changes
+   */
+  void rebalance() {
+    if (size_ > 4 * B_ * B_) rebuild(B_ * 2);
+    else if (B_ > kMinBlock && size_ < B_ * B_ / 16) rebuild(B_ / 2);
+  }
+
+  void check_index(size_t i) const {
+    if (i >= size_) throw out_of_range("Index out of bounds");
+  }
+
+  public:
+  /**
+   * @brief Constructor - creates an empty tiered vector
+   */
+  TieredVector() : B_(kMinBlock), mask_(kMinBlock - 1), size_(0) {}
+
+  /**
+   * @brief Adds an element to the end
+   */
+  void append(T x) {
+    if (blocks_.empty() || blocks_.back().count == B_) blocks_.emplace_back(B_);
+    push_back(blocks_.back(), move(x));
+    ++size_;
+    rebalance();
+  }
+
+  /**
+   * @brief Retrieves element at given index - O(1)
+   * @throws std::out_of_range if index is invalid
+   */
+  const T& get(size_t i) const {
+    check_index(i);
+    return at(blocks_[i / B_], i & mask_);
+  }
+
+  /**
+   * @brief Updates element at given index - O(1)
+   * @throws std::out_of_range if index is invalid
+   */
+  void set(size_t i, T x) {
+    check_index(i);
+    at(blocks_[i / B_], i & mask_) = move(x);
+  }
+
+  /**
+   * @brief Returns the current number of elements
+   */
+  size_t size() const { return size_; }
+
+  /**
+   * @brief Removes the last element
+   */
+  void pop_back() {
+    if (size_ == 0) return;
+    pop(size_ - 1);
+  }
+
+  /**
+   * @brief Removes and returns element at specified index
+   * @throws std::out_of_range if index is invalid
+   *
+   * Time Complexity: O(B + n/B) = O(sqrt n)
+   */
+  T pop(size_t index) {
+    check_index(index);
+    size_t b = index / B_;
+    T val = erase_in_block(blocks_[b], index & mask_);
+    // Refill each full block from the front of its successor
+    for (size_t j = b + 1; j < blocks_.size(); ++j) {
+      push_back(blocks_[j - 1], pop_front(blocks_[j]));
+    }
+    if (blocks_.back().count == 0) blocks_.pop_back();
+    --size_;
+    rebalance();
+    return val;
+  }
+
+  /**
+   * @brief Checks if element exists in the array
+   *
+   * Time Complexity: O(n) - linear search
+   */
+  bool contains(const T& x) const {
+    for (const Block& b : blocks_)
+      for (size_t k = 0; k < b.count; ++k)
+        if (at(b, k) == x) return true;
+    return false;
+  }
+
+  /**
+   * @brief Inserts element at specified index
+   * @throws std::out_of_range if index > size
+   *
+   * Time Complexity: O(B + n/B) = O(sqrt n)
+   */
+  void insert(size_t index, T x) {
+    if (index > size_) throw out_of_range("Index out of bounds");
+    if (index == size_) { append(move(x)); return; }
+    size_t b = index / B_;
+    T carry = move(x);
+    size_t k = index & mask_;
+    // Make room in the target block by evicting its last element
+    if (blocks_[b].count == B_) {
+      T out = pop_back(blocks_[b]);
+      insert_in_block(blocks_[b], k, move(carry));
+      carry = move(out);
+      // Each later full block passes its last element to the next one
+      size_t j = b + 1;
+      for (; j < blocks_.size() && blocks_[j].count == B_; ++j) {
+        T next = pop_back(blocks_[j]);
+        push_front(blocks_[j], move(carry));
+        carry = move(next);
+      }
+      if (j == blocks_.size()) blocks_.emplace_back(B_);
+      push_front(blocks_[j], move(carry));
+    } else {
+      insert_in_block(blocks_[b], k, move(carry));
+    }
+    ++size_;
+    rebalance();
+  }
+
+  /**
+   * @brief Removes first occurrence of specified element
+   * @return Index where element was found, or -1 if not found
+   */
+  long long remove(const T& x) {
+    for (size_t i = 0; i < size_; ++i) {
+      if (at(blocks_[i / B_], i & mask_) == x) {
+        pop(i);
+        return static_cast<long long>(i);
+      }
+    }
+    return -1;
+  }
+};
+
+/*============================================================================
+ * BENCHMARK BASELINE - flat array from dynamic_arrays2.cc
+ *============================================================================*/
+
+/**
+ * @class DynamicArray
+ * @brief int-only flat array with the shifting insert/pop of dynamic_arrays2.cc
+ */
+class DynamicArray {
+  int cap_;
+  int* arr_;
+  int size_;
+
+  void resize(int newCap) {
+    int* temp = new int[newCap];
+    for (int i = 0; i < size_; ++i) temp[i] = arr_[i];
+    delete[] arr_;
+    arr_ = temp;
+    cap_ = newCap;
+  }
+
+  public:
+  DynamicArray(int size = 10) : cap_(size), arr_(new int[cap_]), size_(0) {}
+  ~DynamicArray() { delete[] arr_; }
+  DynamicArray(const DynamicArray&) = delete;
+  DynamicArray& operator=(const DynamicArray&) = delete;
+
+  void append(int x) {
+    arr_[size_] = x;
+    ++size_;
+    if (size_ == cap_) resize(cap_ * 2);
+  }
+
+  size_t size() { return static_cast<size_t>(size_); }
+
+  int pop(int index) {
+    int val = arr_[index];
+    for (int i = index; i < size_ - 1; ++i) arr_[i] = arr_[i + 1];
+    size_--;
+    if (cap_ > 10 && (static_cast<double>(size_) / cap_) < 0.25) resize(cap_ / 2);
+    return val;
+  }
+
+  void insert(int index, int x) {
+    if (size_ + 1 == cap_) resize(cap_ * 2);
+    for (int i = size_; i > index; --i) arr_[i] = arr_[i - 1];
+    size_++;
+    arr_[index] = x;
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+/**
+ * @brief Times ops insert+pop pairs at position frac * size
+ */
+template <typename Array>
+double time_inserts(Array& a, double frac, int ops) {
+  auto t0 = chrono::steady_clock::now();
+  for (int r = 0; r < ops; ++r) {
+    size_t pos = static_cast<size_t>(frac * a.size());
+    a.insert(pos, r);
+    a.pop(pos);
+  }
+  auto t1 = chrono::steady_clock::now();
+  return chrono::duration<double, micro>(t1 - t0).count() / ops;
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: Same API as dynamic_arrays2.cc
+  TieredVector<int> d1;
+  d1.append(1);
+  d1.append(2);
+  d1.append(3);
+  cout << d1.pop(1) << "\n";   // returns 2
+  cout << d1.get(1) << "\n";   // returns 3
+  cout << d1.size() << "\n";   // returns 2
+  cout << boolalpha << d1.contains(1) << " " << d1.contains(2) << "\n";  // true false
+  d1.insert(1, 5);             // [1, 5, 3]
+  cout << d1.get(1) << "\n";   // returns 5
+  cout << d1.remove(3) << "\n";  // returns 2
+
+  // Example 2: Random inserts/pops agree with a std::vector reference
+  TieredVector<int> tv;
+  vector<int> ref;
+  mt19937 rng(42);
+  bool ok = true;
+  for (int step = 0; step < 200000 && ok; ++step) {
+    if (ref.empty() || rng() % 3) {
+      size_t pos = rng() % (ref.size() + 1);
+      tv.insert(pos, step);
+      ref.insert(ref.begin() + pos, step);
+    } else {
+      size_t pos = rng() % ref.size();
+      ok = tv.pop(pos) == ref[pos];
+      ref.erase(ref.begin() + pos);
+    }
+  }
+  for (size_t i = 0; ok && i < ref.size(); ++i) ok = tv.get(i) == ref[i];
+  cout << "matches reference: " << ok << " (size " << tv.size() << ")\n";
+
+  // Example 3: Benchmark insert+pop at several positions
+  int n = argc > 1 ? atoi(argv[1]) : 200000;
+  int ops = argc > 2 ? atoi(argv[2]) : 2000;
+  DynamicArray flat;
+  TieredVector<int> tiered;
+  for (int i = 0; i < n; ++i) { flat.append(i); tiered.append(i); }
+  cout << "n=" << n << ", us per insert+pop pair\n";
+  cout << "position   flat      tiered\n";
+  for (double frac : {0.0, 0.25, 0.5, 0.75, 1.0}) {
+    double f = time_inserts(flat, frac, ops);
+    double t = time_inserts(tiered, frac, ops);
+    cout << frac * 100 << "%\t" << f << "\t" << t << "\n";
+  }
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why circular blocks?
+ * - Passing an element between neighbouring blocks means "pop back of one,
+ *   push front of the next". A circular buffer does push_front in O(1) by
+ *   moving its head, so each of the n/B later blocks costs O(1).
+ *
+ * Why B ~ sqrt(n)?
+ * - insert/pop cost O(B) inside the target block plus O(n/B) across later
+ *   blocks. B = sqrt(n) balances both terms at O(sqrt n).
+ *
+ * Trade-off vs the flat array:
+ * - get(i) needs a division (shift) and a masked index: slightly slower
+ * - append at the end and insert near the end stay cheap in both
+ *
+ *============================================================================*/
@@ -0,0 +1,232 @@
+/**
+ * @file bottom_up_heap_sort.cc
+ * @brief Heap sort with three sift-down strategies and operation counters
+ *
+ * heap_sort2.cc sorts with a recursive maxheapify() that swaps at every
+ * level. This file implements the same ascending (max-heap) heap sort with
+ * three sift-down routines and counts comparisons and element moves:
+ *
+ * 1. swap:      heap_sort2.cc's algorithm (made iterative) - 2 comparisons
+ *               and one swap (3 moves) per level
+ * 2. hole:      lift the element out, move children up into the "hole",
+ *               write the element once at the end - 2 comparisons and
+ *               1 move per level
+ * 3. bottom_up: Floyd's variant - descend to a leaf choosing the larger
+ *               child (1 comparison per level), then climb back up until
+ *               the element fits. During sort() the element came from the
+ *               bottom of the heap, so the climb is usually 1-2 levels
+ *
+ * Key Concepts:
+ * - During sort() the sifted element is the old last leaf: small, and
+ *   almost always ends up near the bottom again
+ * - swap/hole compare it with the larger child at every level (wasted);
+ *   bottom_up skips that and pays only on the short climb back up
+ * - Result: ~n log2 n comparisons instead of ~2n log2 n
+ *
+ * Time Complexities (all three):
+ * - Build heap: O(n)
+ * - sort():     O(n log n)
+ *
+ * Space Complexity: O(1) auxiliary - sorting is done in-place
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace std;
+
+/**
+ * @struct SortStats
+ * @brief Comparisons and element moves performed by one sort
+ *
+ * A swap counts as 3 moves (tmp = a; a = b; b = tmp).
+ */
+struct SortStats {
+  long long comparisons = 0;
+  long long moves = 0;
+};
+
+enum class SiftDown { swap, hole, bottom_up };
+
+/**
+ * @class HeapSorter
+ * @brief Max-heap heap sort (ascending order) with counted operations
+ */
+class HeapSorter {
+  vector<int>& arr_;   // Array being sorted in place
+  SiftDown kind_;      // Sift-down strategy
+  SortStats stats_;    // Counters for the current sort
+
+  bool less(int a, int b) { ++stats_.comparisons; return a < b; }
+
+  /**
+   * @brief heap_sort2.cc's maxheapify(i, n), iterative
+   */
+  void sift_swap(int i, int n) {
+    while (true) {
+      int largest = i;
+      int left  = 2 * i + 1;
+      int right = 2 * i + 2;
+      if (left  < n && less(arr_[largest], arr_[left]))  largest = left;
+      if (right < n && less(arr_[largest], arr_[right])) largest = right;
+      if (largest == i) return;
+      swap(arr_[i], arr_[largest]);
+      stats_.moves += 3;
+      i = largest;
+    }
+  }
+
+  /**
+   * @brief Hole technique: children move up, the element is written once
+   *
+   *   x = arr[i]            hole at i
+   *   child > x ?           arr[hole] = child, hole = child
+   *   ...
+   *   arr[hole] = x
+   */
+  void sift_hole(int i, int n) {
+    int x = arr_[i];
+    ++stats_.moves;
+    while (true) {
+      int child = 2 * i + 1;
+      if (child >= n) break;
+      if (child + 1 < n && less(arr_[child], arr_[child + 1])) ++child;
+      if (!less(x, arr_[child])) break;
+      arr_[i] = arr_[child];
+      ++stats_.moves;
+      i = child;
+    }
+    arr_[i] = x;
+    ++stats_.moves;
+  }
+
+  /**
+   * @brief Floyd's bottom-up sift-down
+   *
+   * Phase 1: walk the hole down to a leaf, always promoting the larger
+   *          child - one comparison per level, x is never compared.
+   * Phase 2: sift x up from that leaf, but not above i.
+   */
+  void sift_bottom_up(int i, int n) {
+    int x = arr_[i];
+    ++stats_.moves;
+    int top = i;
+    int child = 2 * i + 1;
+    while (child < n) {
+      if (child + 1 < n && less(arr_[child], arr_[child + 1])) ++child;
+      arr_[i] = arr_[child];
+      ++stats_.moves;
+      i = child;
+      child = 2 * i + 1;
+    }
+    while (i > top) {
+      int parent = (i - 1) / 2;
+      if (!less(arr_[parent], x)) break;
+      arr_[i] = arr_[parent];
+      ++stats_.moves;
+      i = parent;
+    }
+    arr_[i] = x;
+    ++stats_.moves;
+  }
+
+  void sift_down(int i, int n) {
+    switch (kind_) {
+      case SiftDown::swap:      sift_swap(i, n); break;
+      case SiftDown::hole:      sift_hole(i, n); break;
+      case SiftDown::bottom_up: sift_bottom_up(i, n); break;
+    }
+  }
+
+  public:
+  HeapSorter(vector<int>& arr, SiftDown kind) : arr_(arr), kind_(kind) {}
+
+  /**
+   * @brief Sorts the array in ASCENDING order
+   * @return Comparisons and moves used (build + sort phases)
+   *
+   * Time Complexity: O(n log n)
+   */
+  SortStats sort() {
+    stats_ = SortStats{};
+    int n = arr_.size();
+    for (int i = n / 2 - 1; i >= 0; --i) sift_down(i, n);
+    for (int i = n - 1; i >= 1; --i) {
+      swap(arr_[0], arr_[i]);
+      stats_.moves += 3;
+      sift_down(0, i);
+    }
+    return stats_;
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+const char* name(SiftDown kind) {
+  switch (kind) {
+    case SiftDown::swap:      return "swap";
+    case SiftDown::hole:      return "hole";
+    case SiftDown::bottom_up: return "bottom_up";
+  }
+  return "";
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: Same input as heap_sort2.cc
+  for (SiftDown kind : {SiftDown::swap, SiftDown::hole, SiftDown::bottom_up}) {
+    vector<int> arr{4, 8, 2, 6, 1, 3};
+    HeapSorter(arr, kind).sort();
+    for (int v : arr) cout << v << ' ';
+    cout << "(" << name(kind) << ")\n";   // 1 2 3 4 6 8
+  }
+
+  // Example 2: Counters on n random ints (default 10^6; pass 10000000 for 10^7)
+  int n = argc > 1 ? atoi(argv[1]) : 1000000;
+  mt19937 rng(14);
+  vector<int> input(n);
+  for (int& v : input) v = rng();
+  vector<int> expected = input;
+  sort(expected.begin(), expected.end());
+
+  long long base_cmp = 0;
+  for (SiftDown kind : {SiftDown::swap, SiftDown::hole, SiftDown::bottom_up}) {
+    vector<int> arr = input;
+    auto t0 = chrono::steady_clock::now();
+    SortStats s = HeapSorter(arr, kind).sort();
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - t0).count();
+    if (kind == SiftDown::swap) base_cmp = s.comparisons;
+    cout << name(kind) << ": " << s.comparisons << " comparisons ("
+         << static_cast<double>(base_cmp) / s.comparisons << "x fewer), "
+         << s.moves << " moves, " << ms << "ms, sorted: " << boolalpha
+         << (arr == expected) << "\n";
+  }
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why is the climb in bottom_up short?
+ * - Half the nodes of a heap are leaves and a quarter sit one level above.
+ *   The element being sifted was a leaf a moment ago, so it usually
+ *   belongs near the bottom: the climb costs ~1-2 comparisons instead of
+ *   the ~log2 n "is x larger than the larger child?" tests it replaces.
+ *
+ * When is bottom_up worse?
+ * - When the sifted element belongs near the top (e.g. pop() on a heap fed
+ *   with mostly increasing priorities), it descends all the way and then
+ *   climbs all the way back. For heap sort and ordinary pops it wins.
+ *
+ * Moves:
+ * - swap performs 3 moves per level; hole and bottom_up one per level, so
+ *   expensive-to-move elements benefit even when comparisons are cheap.
+ *
+ *============================================================================*/
@@ -0,0 +1,246 @@
+/**
+ * @file dary_heap.cc
+ * @brief Cache-friendly d-ary heap (2/4/8-ary) with a benchmark suite
+ *
+ * Heap::minheapify in heap_implementation.cc uses 2*i+1 and 2*i+2. Once the
+ * heap is larger than the cache, nearly every level of a sift-down touches a
+ * new cache line. A d-ary heap has log_d(n) levels instead of log_2(n), and
+ * if each group of D siblings lies in one 64-byte line, every level costs
+ * one cache miss while comparing D children.
+ *
+ * Layout: logical node i lives at physical slot i + (D - 1), so the children
+ * of i, logically D*i+1 .. D*i+D, sit at physical D*(i+1) .. D*(i+1)+D-1 -
+ * always a multiple of D. With a 64-byte aligned buffer and D*sizeof(T)
+ * dividing 64, each sibling group occupies exactly one cache line:
+ *
+ *   physical: [pad pad pad | root | c1 c2 c3 c4 | ...]      (D = 4, 16-byte groups)
+ *              0   1   2     3      4  5  6  7
+ *
+ * Key Concepts:
+ * - Arity D fixed at compile time (2, 4 or 8) - division by D is a shift
+ * - Hole technique: sifting moves a hole and writes the element once
+ * - pop() does D-1 comparisons per level but over log_d(n) levels
+ *
+ * Time Complexities:
+ * - push(): O(log_d n)
+ * - pop():  O(D log_d n)
+ * - top()/size(): O(1)
+ *
+ * Space Complexity: O(n) plus D-1 padding slots
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <vector>
+using namespace std;
+
+/**
+ * @struct AlignedAllocator
+ * @brief Allocator returning Align-byte aligned blocks (C++17 aligned new)
+ */
+template <typename T, size_t Align>
+struct AlignedAllocator {
+  using value_type = T;
+  template <typename U> struct rebind { using other = AlignedAllocator<U, Align>; };
+  AlignedAllocator() = default;
+  template <typename U> AlignedAllocator(const AlignedAllocator<U, Align>&) {}
+  T* allocate(size_t n) {
+    return static_cast<T*>(::operator new(n * sizeof(T), align_val_t(Align)));
+  }
+  void deallocate(T* p, size_t) { ::operator delete(p, align_val_t(Align)); }
+  bool operator==(const AlignedAllocator&) const { return true; }
+  bool operator!=(const AlignedAllocator&) const { return false; }
+};
+
+/**
+ * @class DaryHeap
+ * @brief D-ary heap with cache-line aligned sibling groups
+ * @tparam T       Element type
+ * @tparam D       Arity (2, 4 or 8)
+ * @tparam Compare higher_priority(a, b): true if a belongs above b
+ */
+template <typename T, size_t D = 4, typename Compare = less<T>>
+class DaryHeap {
+  static_assert(D == 2 || D == 4 || D == 8, "arity must be 2, 4 or 8");
+  static constexpr size_t kLine = 64;
+  static constexpr size_t kPad = D - 1;   // Physical index of the root
+
+  vector<T, AlignedAllocator<T, kLine>> arr_;   // kPad padding slots + heap
+  Compare higher_;
+
+  /**
+   * @brief Moves the element at physical slot p up (hole technique)
+   */
+  void sift_up(size_t p) {
+    T elem = move(arr_[p]);
+    while (p > kPad) {
+      size_t parent = (p - kPad - 1) / D + kPad;
+      if (!higher_(elem, arr_[parent])) break;
+      arr_[p] = move(arr_[parent]);
+      p = parent;
+    }
+    arr_[p] = move(elem);
+  }
+
+  /**
+   * @brief Moves the element at physical slot p down (hole technique)
+   *
+   * Children of physical p start at D*(p - kPad + 1), a multiple of D.
+   */
+  void sift_down(size_t p) {
+    size_t n = arr_.size();
+    T elem = move(arr_[p]);
+    while (true) {
+      size_t first = D * (p - kPad + 1);
+      if (first >= n) break;
+      size_t last = first + D < n ? first + D : n;
+      size_t best = first;
+      for (size_t c = first + 1; c < last; ++c)
+        if (higher_(arr_[c], arr_[best])) best = c;
+      if (!higher_(arr_[best], elem)) break;
+      arr_[p] = move(arr_[best]);
+      p = best;
+    }
+    arr_[p] = move(elem);
+  }
+
+  public:
+  explicit DaryHeap(Compare higher = Compare()) : arr_(kPad), higher_(move(higher)) {}
+
+  size_t size() const { return arr_.size() - kPad; }
+  bool empty() const { return size() == 0; }
+
+  /**
+   * @brief Pre-allocates room for n elements
+   */
+  void reserve(size_t n) { arr_.reserve(n + kPad); }
+
+  /**
+   * @throws std::out_of_range if the heap is empty
+   */
+  const T& top() const {
+    if (empty()) throw out_of_range("top() on empty heap");
+    return arr_[kPad];
+  }
+
+  void push(T elem) {
+    arr_.push_back(move(elem));
+    sift_up(arr_.size() - 1);
+  }
+
+  /**
+   * @throws std::out_of_range if the heap is empty
+   */
+  T pop() {
+    if (empty()) throw out_of_range("pop() on empty heap");
+    T root = move(arr_[kPad]);
+    if (size() > 1) arr_[kPad] = move(arr_.back());
+    arr_.pop_back();
+    if (!empty()) sift_down(kPad);
+    return root;
+  }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+using Clock = chrono::steady_clock;
+
+double ns_per(Clock::time_point t0, size_t ops) {
+  return chrono::duration<double, nano>(Clock::now() - t0).count() / ops;
+}
+
+/**
+ * @brief Runs push, pop and mixed workloads on a heap of n random ints
+ *
+ * - push:  n pushes into an empty heap
+ * - pop:   n pops until empty
+ * - mixed: refill to n, then n rounds of pop + push(popped + random)
+ */
+template <size_t D>
+void bench(size_t n, const vector<unsigned>& keys) {
+  DaryHeap<unsigned, D> h;
+  h.reserve(n);
+  auto t0 = Clock::now();
+  for (size_t i = 0; i < n; ++i) h.push(keys[i]);
+  double push_ns = ns_per(t0, n);
+
+  unsigned check = 0;
+  t0 = Clock::now();
+  for (size_t i = 0; i < n; ++i) check ^= h.pop();
+  double pop_ns = ns_per(t0, n);
+
+  for (size_t i = 0; i < n; ++i) h.push(keys[i]);
+  t0 = Clock::now();
+  for (size_t i = 0; i < n; ++i) h.push(h.pop() + (keys[i] & 1023));
+  double mixed_ns = ns_per(t0, n);
+
+  cout << "  " << D << "-ary: push " << push_ns << "  pop " << pop_ns
+       << "  mixed " << mixed_ns << "  ns/op (check " << check << ")\n";
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: Same results as a binary min-heap
+  DaryHeap<int, 4> h;
+  for (int x : {4, 8, 2, 6, 1}) h.push(x);
+  cout << h.pop() << "\n";    // Returns 1
+  cout << h.pop() << "\n";    // Returns 2
+  cout << h.top() << "\n";    // Returns 4
+  cout << h.size() << "\n";   // Returns 3
+
+  // Example 2: Max-heap with 8 children per node
+  DaryHeap<int, 8, greater<int>> h2;
+  for (int x : {1, 8, 2, 4, 6}) h2.push(x);
+  cout << h2.pop() << " " << h2.pop() << "\n";   // 8 6
+
+  // Example 3: Random check against sorted order
+  mt19937 rng(9);
+  DaryHeap<unsigned, 8> h3;
+  vector<unsigned> vals(10000);
+  for (auto& v : vals) { v = rng() % 1000; h3.push(v); }
+  sort(vals.begin(), vals.end());
+  bool ok = true;
+  for (unsigned v : vals) ok = ok && h3.pop() == v;
+  cout << boolalpha << "pops in sorted order: " << ok << "\n";
+
+  // Example 4: Benchmark for n = 10^3 .. 10^max_exp (default 10^6; 8 = 10^8)
+  int max_exp = argc > 1 ? atoi(argv[1]) : 6;
+  size_t max_n = 1;
+  for (int e = 0; e < max_exp; ++e) max_n *= 10;
+  vector<unsigned> keys(max_n);
+  for (auto& k : keys) k = rng();
+  for (size_t n = 1000; n <= max_n; n *= 10) {
+    cout << "n = " << n << "\n";
+    bench<2>(n, keys);
+    bench<4>(n, keys);
+    bench<8>(n, keys);
+  }
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why does a wider heap help?
+ * - Height drops from log2(n) to log_D(n): 3x fewer levels for D = 8.
+ * - Comparisons per pop grow to (D-1) per level, but those D children are
+ *   adjacent in one cache line, so the extra work costs no extra misses.
+ *
+ * Which D to choose?
+ * - 4 is a safe default: half the levels of a binary heap, 3 comparisons
+ *   per level, and the best pop()/mixed times in the benchmark above.
+ * - 8 only pays off once the heap is far larger than the last-level cache
+ *   (10^7+ elements) and misses dominate the extra comparisons.
+ * - push() only gets cheaper as D grows (shorter path to the root).
+ * - For large T (D * sizeof(T) > 64) a sibling group spans several lines;
+ *   prefer storing indices or pointers in the heap.
+ *
+ *============================================================================*/
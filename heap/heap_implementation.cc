@@ -19,11 +19,15 @@
  * - top():               O(1) - access root element
  * - push():              O(log n) - bubble up
  * - pop():               O(log n) - heapify down
+ * - push_bulk(m elems):  O(m log n) small batch, O(n + m) large batch
+ * - pop_n(k):            O(k log n)
  * 
  * Space Complexity: O(n) where n is the number of elements
  */
 
+#include <cmath>
 #include <iostream>
+#include <iterator>
 #include <vector>
 using namespace std;
 
@@ -42,18 +46,30 @@ class Heap {
   /**
    * @brief Restores min-heap property starting from given index (sift down)
    * @param index Starting index for heapification
+   * @param n Heap size (elements at n and beyond are excluded)
    * 
-   * Recursively swaps with smaller child until heap property is satisfied.
+   * Moves smaller children up into a hole until heap property is satisfied.
    */
-  void minheapify(int);
+  void minheapify(int, int);
   
   /**
    * @brief Restores max-heap property starting from given index (sift down)
    * @param index Starting index for heapification
+   * @param n Heap size (elements at n and beyond are excluded)
    * 
-   * Recursively swaps with larger child until heap property is satisfied.
+   * Moves larger children up into a hole until heap property is satisfied.
    */
-  void maxheapify(int);
+  void maxheapify(int, int);
+  
+  /**
+   * @brief Floyd's heap construction over the whole array - O(n)
+   */
+  void build();
+  
+  /**
+   * @brief Moves arr_[index] up until its parent has higher priority
+   */
+  void siftup(int);
   
   /**
    * @brief Calculates parent index of a given node
@@ -101,6 +117,32 @@ class Heap {
    */
   int pop();
   
+  /**
+   * @brief Adds a batch of elements to the heap
+   * @param first, last Range of elements to insert
+   * 
+   * Small batches are sifted up one by one. When the batch is large
+   * relative to the heap, all elements are appended and the heap is
+   * rebuilt once with Floyd's construction.
+   * 
+   * Time Complexity: O(min(m log n, n + m)) for m new elements
+   */
+  template <typename It>
+  void push_bulk(It first, It last);
+  void push_bulk(const vector<int>& elems);
+  
+  /**
+   * @brief Removes and returns the k highest-priority elements
+   * @param k Number of elements to pop (clamped to size())
+   * @return Elements in priority order (highest first)
+   * 
+   * Heap-sort style: each pop swaps the root to the end of a shrinking
+   * heap, and the array is truncated once at the end.
+   * 
+   * Time Complexity: O(k log n)
+   */
+  vector<int> pop_n(int k);
+  
   /**
    * @brief Prints all heap elements (for debugging)
    */
@@ -139,15 +181,23 @@ int Heap::parent(int index) {
  * - Summing over all nodes gives O(n)
  */
 Heap::Heap(string priority, vector<int>&arr) : arr_{arr},priority_{priority} {
+  build();
+}
+
+/**
+ * build() - Floyd's heap construction, shared by the constructor and
+ * push_bulk()
+ */
+void Heap::build() {
   int n = arr_.size();
   if(priority_=="<") {
     for(int i=n/2-1;i>=0;--i) {
-      minheapify(i);
+      minheapify(i,n);
     }
   }
   else if(priority_==">") {
     for(int i=n/2-1;i>=0;--i) {
-      maxheapify(i);
+      maxheapify(i,n);
     }
   }
 }
@@ -167,49 +217,50 @@ int Heap::top() { if(arr_.size()==0)return -1; return arr_[0];}
 /**
  * minheapify() - Restore min-heap property (sift down)
  * 
- * Algorithm:
- * 1. Compare node with both children
- * 2. Find the smallest among node and its children
- * 3. If node is not smallest, swap with smallest child
- * 4. Recursively heapify the affected subtree
+ * Algorithm (hole technique):
+ * 1. Lift the node's value out, leaving a "hole" at index
+ * 2. While the smaller child is smaller than the value, move that child
+ *    up into the hole and continue from the child's position
+ * 3. Write the value once into the final hole
+ * 
+ * Iterative, and one write per level instead of a 3-move swap
+ * (see bottom_up_heap_sort.cc for the counted comparison).
  * 
  * Time Complexity: O(log n) - at most height of tree comparisons
  */
-void Heap::minheapify(int index) {
-  int smallest = index;
-  int n = arr_.size();
-  int left  = 2*smallest+1;
-  int right = 2*smallest+2;
-  if(left<n && arr_[smallest]> arr_[left])  { smallest = left; }
-  if(right<n && arr_[smallest]> arr_[right]) { smallest = right; }
-  if(smallest==index) return;
-  swap(arr_[smallest],arr_[index]);
-  minheapify(smallest);
-  return;
+void Heap::minheapify(int index, int n) {
+  if(index>=n) return;
+  int val = arr_[index];
+  while(true) {
+    int child = 2*index+1;
+    if(child>=n) break;
+    if(child+1<n && arr_[child+1]<arr_[child]) { ++child; }
+    if(!(arr_[child]<val)) break;
+    arr_[index] = arr_[child];
+    index = child;
+  }
+  arr_[index] = val;
 }
 
 /**
  * maxheapify() - Restore max-heap property (sift down)
  * 
- * Algorithm:
- * 1. Compare node with both children
- * 2. Find the largest among node and its children
- * 3. If node is not largest, swap with largest child
- * 4. Recursively heapify the affected subtree
+ * Same hole technique as minheapify(), moving the larger child up.
  * 
  * Time Complexity: O(log n) - at most height of tree comparisons
  */
-void Heap::maxheapify(int index) {
-  int largest = index;
-  int n = arr_.size();
-  int left  = 2*largest+1;
-  int right = 2*largest+2;
-  if(left<n && arr_[largest] < arr_[left])  { largest = left; }
-  if(right<n && arr_[largest] < arr_[right]) { largest = right; }
-  if(largest==index) return;
-  swap(arr_[largest],arr_[index]);
-  maxheapify(largest);
-  return;
+void Heap::maxheapify(int index, int n) {
+  if(index>=n) return;
+  int val = arr_[index];
+  while(true) {
+    int child = 2*index+1;
+    if(child>=n) break;
+    if(child+1<n && arr_[child+1]>arr_[child]) { ++child; }
+    if(!(arr_[child]>val)) break;
+    arr_[index] = arr_[child];
+    index = child;
+  }
+  arr_[index] = val;
 }
 
 /**
@@ -224,8 +275,13 @@ void Heap::maxheapify(int index) {
  */
 void Heap::push(int elem) {
   arr_.push_back(elem);
-  int n = arr_.size();
-  int index = n-1;
+  siftup(arr_.size()-1);
+}
+
+/**
+ * siftup() - Bubble arr_[index] up towards the root
+ */
+void Heap::siftup(int index) {
   if(priority_=="<") {
     while(index!=0 && arr_[parent(index)]>arr_[index]) {
       swap(arr_[parent(index)],arr_[index]);
@@ -256,10 +312,59 @@ int Heap::pop() {
   int elem = arr_[0];
   arr_[0] = arr_[n-1];
   arr_.pop_back();
-  (priority_=="<")?minheapify(0):maxheapify(0);
+  n = arr_.size();
+  (priority_=="<")?minheapify(0,n):maxheapify(0,n);
   return elem;
 }
 
+/**
+ * push_bulk() - Append a batch, then sift up or rebuild
+ * 
+ * Cost model (n = current size, m = batch size):
+ * - Sift up each:  up to m * log2(n + m) steps
+ * - Rebuild:       about 2 * (n + m) steps (Floyd)
+ * Rebuild when the first estimate is larger, i.e. the batch is a sizable
+ * fraction of the heap.
+ */
+template <typename It>
+void Heap::push_bulk(It first, It last) {
+  int n = arr_.size();
+  arr_.insert(arr_.end(), first, last);
+  int total = arr_.size();
+  int m = total-n;
+  if(m==0) return;
+  if(static_cast<double>(m)*log2(total+1) > 2.0*total) {
+    build();
+  } else {
+    for(int i=n;i<total;++i) siftup(i);
+  }
+}
+
+void Heap::push_bulk(const vector<int>& elems) {
+  push_bulk(elems.begin(), elems.end());
+}
+
+/**
+ * pop_n() - Pop k elements without shrinking the vector in between
+ * 
+ * Example (min-heap [1, 3, 2, 7, 4], k = 2):
+ * - swap root to index 4, heapify [0, 4)  -> [2, 3, 4, 7 | 1]
+ * - swap root to index 3, heapify [0, 3)  -> [3, 7, 4 | 2, 1]
+ * - result = tail reversed = [1, 2], truncate to [3, 7, 4]
+ */
+vector<int> Heap::pop_n(int k) {
+  int n = arr_.size();
+  if(k>n) k = n;
+  if(k<=0) return {};
+  for(int i=n-1;i>=n-k;--i) {
+    swap(arr_[0],arr_[i]);
+    (priority_=="<")?minheapify(0,i):maxheapify(0,i);
+  }
+  vector<int> res(arr_.rbegin(), arr_.rbegin()+k);
+  arr_.resize(n-k);
+  return res;
+}
+
 /**
  * print() - Display heap contents for debugging
  */
@@ -296,6 +401,16 @@ int main() {
  cout<<h2.pop()<<"\n";    
  cout<<h2.pop()<<"\n";    
  cout<<h2.pop()<<"\n";    
+ // push_bulk: small batch sifts up, large batch rebuilds with Floyd
+ Heap h3 = Heap("<", arr);   // [1, 2, 4, 6, 8]
+ h3.push_bulk({5, 3});       // small batch: sift up each
+ h3.push_bulk(vector<int>{20, 0, 15, 9, 7, 11, 13, 12, 10, 14, 16, 17});   // rebuild
+ cout<<h3.size()<<"\n";     // Returns 19.
+ // pop_n: the k highest-priority elements, in order
+ for(int x : h3.pop_n(5)) cout<<x<<" ";
+ cout<<"\n";                // 0 1 2 3 4
+ cout<<h3.top()<<"\n";      // Returns 5.
+ cout<<h3.size()<<"\n";     // Returns 14.
 return 0;
 }
 
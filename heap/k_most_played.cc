@@ -12,10 +12,15 @@
  * 
  * Algorithm:
  * 1. Iterate through all songs
- * 2. Push each song (plays, title) into min-heap
+ * 2. Push each song (plays, index) into min-heap
  * 3. If heap size exceeds k, pop the minimum (least played)
  * 4. After processing all songs, heap contains k most played
  * 
+ * Why (plays, index) instead of (plays, title)?
+ * - The song's position in the input is already a dense ID for its
+ *   title, so heap entries are two integers: no string is copied on push
+ *   or compared on ties. Only the k winning titles are copied out.
+ * 
  * Why Min-Heap for finding maximums?
  * - We want to keep track of the k LARGEST elements
  * - Min-heap allows quick removal of the SMALLEST in our k candidates
@@ -42,7 +47,7 @@ using namespace std;
  * 
  * Implementation Details:
  * - Uses priority_queue with greater<> comparator for min-heap
- * - Stores pairs as (plays, title) for proper comparison by plays
+ * - Stores pairs as (plays, index) for proper comparison by plays
  * - Returns titles in reverse order of extraction (min to max)
  * 
  * Time Complexity: O(n log k)
@@ -56,11 +61,11 @@ vector<string> k_most_played(vector<pair<string,int>>& songs, int k) {
   vector<string> res;
   
   // Min-heap: smallest play count at top
-  // Pair: (plays, title) - plays first for proper ordering
-  priority_queue<pair<int,string>,vector<pair<int,string>>,greater<pair<int,string>>> pq;
+  // Pair: (plays, index into songs) - plays first for proper ordering
+  priority_queue<pair<int,int>,vector<pair<int,int>>,greater<pair<int,int>>> pq;
   
-  for(auto& p : songs) {
-    pq.push({p.second,p.first});  // Push (plays, title)
+  for(size_t i=0;i<songs.size();++i) {
+    pq.push({songs[i].second,static_cast<int>(i)});  // Push (plays, index)
     
     // Maintain heap size at k by removing minimum when exceeded
     if(pq.size()>static_cast<size_t>(k)) pq.pop();
@@ -68,7 +73,7 @@ vector<string> k_most_played(vector<pair<string,int>>& songs, int k) {
   
   // Extract remaining k songs from heap
   while(!pq.empty()) {
-    res.push_back(pq.top().second);
+    res.push_back(songs[pq.top().second].first);  // Title copied only here
     pq.pop();
   }
   return res;
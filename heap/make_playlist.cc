@@ -11,8 +11,9 @@
  * - Interleaving: Alternate between artists to avoid consecutive same-artist
  * 
  * Algorithm:
- * 1. Group songs by artist into a hash map
- * 2. Build max-heap with (artist, songsList) ordered by list size
+ * 1. Group songs by artist: intern artist names to dense IDs and keep the
+ *    song positions of each artist in a vector indexed by ID
+ * 2. Build max-heap of (songs left, artist ID) - no strings in the heap
  * 3. Greedily pick from artist with most songs (ensures spread)
  * 4. If top artist == last used artist, pick second-top instead
  * 5. Re-push artist if they have more songs remaining
@@ -26,14 +27,14 @@
  * Time Complexity: O(n log m) where n = songs, m = unique artists
  *   - Each song is pushed/popped once: O(log m) per operation
  * 
- * Space Complexity: O(n + m) - hash map + heap storage
+ * Space Complexity: O(n + m) - interned artists + song positions + heap
  */
 
 #include <iostream>
 #include <vector>
 #include <string>
-#include <unordered_map>
 #include <queue>
+#include "string_interner.h"
 using namespace std;
 
 /*============================================================================
@@ -45,9 +46,11 @@ using namespace std;
  * @param songs Vector of (title, artist) pairs
  * @return Reordered song titles, or empty vector if impossible
  * 
- * Heap Structure: {artist, songsList}
- * - Max-heap ordered by songsList.size() (most songs = highest priority)
- * - Custom comparator: a.size < b.size gives max-heap behavior
+ * Heap Structure: {songs left, artist ID}
+ * - Max-heap ordered by songs left (most songs = highest priority)
+ * - Artist names are interned once (string_interner.h); the heap and the
+ *   per-artist lists hold only IDs and song positions, and titles are
+ *   copied into the result only when scheduled
  * 
  * Greedy Strategy:
  * - Always pick from artist with most remaining songs
@@ -60,42 +63,46 @@ vector<string> make_playlist(vector<pair<string,string>>& songs) {
   vector<string> res;
   
   // Step 1: Group songs by artist
-  // Key: artist name, Value: list of song titles
-  unordered_map<string, vector<string>> umap;
-  for(auto&song: songs) {
-    umap[song.second].push_back(song.first);
+  // artists: name -> dense ID, byArtist[ID]: positions of its songs
+  StringInterner artists;
+  vector<vector<int>> byArtist;
+  for(size_t i=0;i<songs.size();++i) {
+    StringInterner::Id id = artists.intern(songs[i].second);
+    if(id==byArtist.size()) byArtist.emplace_back();
+    byArtist[id].push_back(i);
   }
   
   // Step 2: Build max-heap ordered by number of songs per artist
-  // HeapEntry = {artist_name, list_of_songs}
-  using HeapEntry = pair<string, vector<string>>;
-  auto cmp = [](const HeapEntry& a, const HeapEntry& b) {
-    return a.second.size() < b.second.size();  // For max heap
-  };
-  priority_queue<HeapEntry, vector<HeapEntry>, decltype(cmp)> max_heap(cmp);
+  // HeapEntry = {songs_left, artist_id}
+  using HeapEntry = pair<size_t, StringInterner::Id>;
+  priority_queue<HeapEntry> max_heap;
 
-  for (const auto& [artist, songsList] : umap) {
-    max_heap.push({artist, songsList});
+  for (StringInterner::Id id = 0; id < byArtist.size(); ++id) {
+    max_heap.push({byArtist[id].size(), id});
   }
   
   // Track last artist to avoid consecutive same-artist
-  string lastArtist;
+  StringInterner::Id lastArtist = StringInterner::kNone;
+  
+  // Takes the artist's next song into the playlist; re-pushes if any remain
+  auto schedule = [&](StringInterner::Id artist) {
+    vector<int>& songList = byArtist[artist];
+    res.push_back(songs[songList.back()].first);
+    songList.pop_back();
+    lastArtist = artist;
+    if (!songList.empty()) {
+      max_heap.push({songList.size(), artist});
+    }
+  };
   
   // Step 3-6: Greedy selection with interleaving
   while (!max_heap.empty()) {
-    auto [artist, songList] = max_heap.top();
+    StringInterner::Id artist = max_heap.top().second;
     max_heap.pop();
     
     // Case A: Different artist than last - safe to use
     if (artist != lastArtist) {
-      res.push_back(songList.back());
-      songList.pop_back();
-      lastArtist = artist;
-      
-      // Re-push if artist has more songs
-      if (!songList.empty()) {
-        max_heap.push({artist, songList});
-      }
+      schedule(artist);
     } 
     // Case B: Same artist as last - must use second choice
     else {
@@ -105,17 +112,10 @@ vector<string> make_playlist(vector<pair<string,string>>& songs) {
       }
       
       // Use second-top artist instead
-      auto [artist2, songList2] = max_heap.top();
+      StringInterner::Id artist2 = max_heap.top().second;
       max_heap.pop();
-      res.push_back(songList2.back());
-      songList2.pop_back();
-      lastArtist = artist2;
-      
-      // Re-push both artists if they have remaining songs
-      if (!songList2.empty()) {
-        max_heap.push({artist2, songList2});
-      }
-      max_heap.push({artist, songList});  // Put first artist back
+      schedule(artist2);
+      max_heap.push({byArtist[artist].size(), artist});  // Put first artist back
     }
   }
   return res;
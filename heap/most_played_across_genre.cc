@@ -10,6 +10,9 @@
  * - K-Way Merge: Classic technique for merging m sorted lists
  * - Max-Heap: Efficiently extracts the global maximum from m candidates
  * - Lazy Loading: Only one song per genre in the heap at any time
+ * - No strings in the heap: (genre, position) already identifies a song,
+ *   so entries are (plays, genre) integer pairs and a title is copied
+ *   only when it is emitted
  * 
  * Algorithm:
  * 1. Initialize heap with first (most-played) song from each genre
@@ -48,25 +51,26 @@ using namespace std;
  * @param k Number of top songs to return
  * @return Vector of k song titles with highest play counts
  * 
- * Heap Structure: {{plays, title}, genre_index}
+ * Heap Structure: {plays, genre_index}
  * - plays is first for max-heap ordering by play count
- * - genre_index tracks which list the song came from
+ * - genre_index tracks which list the song came from; index_vec holds
+ *   its position, so the title is looked up only when it is emitted
  * 
  * Time Complexity: O((m + k) log m) where m = number of genres
  */
 vector<string> most_listened_across_genres(vector<vector<pair<string,int>>>& genres, int k) {
   vector<string> res;
   
-  // Max-heap: {{plays, title}, genre_index}
+  // Max-heap: {plays, genre_index}
   // Default priority_queue is max-heap, orders by plays (first element)
-  priority_queue<pair<pair<int,string>,int>> pq;
+  priority_queue<pair<int,int>> pq;
   
   int n = genres.size();  // m = number of genres
   
   // Step 1: Initialize heap with first song from each genre
   // Each genre's first song is its most-played (pre-sorted)
   for(int i=0;i<n;++i) {
-    pq.push({{genres[i][0].second,genres[i][0].first},i});
+    pq.push({genres[i][0].second,i});
   }
   
   // Track current index in each genre's song list
@@ -76,16 +80,16 @@ vector<string> most_listened_across_genres(vector<vector<pair<string,int>>>& gen
   while(!pq.empty()) {
     // Pop globally most-played song
     auto p = pq.top(); pq.pop();
-    res.push_back(p.first.second);
+    int index = p.second;
+    res.push_back(genres[index][index_vec[index]].first);
     
     // Done if we have k songs
     if(res.size()==static_cast<size_t>(k)) break;
     
     // Push next song from the same genre (if available)
-    int index = p.second;
     int j = ++index_vec[index];
     if(static_cast<size_t>(j)==genres[index].size()) continue;
-    pq.push({{genres[index][j].second,genres[index][j].first},index});
+    pq.push({genres[index][j].second,index});
   }
   
   return res;
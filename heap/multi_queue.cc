@@ -0,0 +1,320 @@
+/**
+ * @file multi_queue.cc
+ * @brief Relaxed concurrent priority queue (MultiQueue)
+ *
+ * Wrapping one heap in a mutex serializes every thread on it. A MultiQueue
+ * keeps c*p independent heaps (p threads, c a small constant), each with
+ * its own lock, and relaxes the semantics: pop() returns *one of the
+ * smallest* keys rather than exactly the smallest.
+ *
+ *   push(x): pick a random heap, try_lock it (else pick another), push
+ *   pop():   pick two random heaps, compare their cached tops without
+ *            locking, try_lock the better one and pop from it
+ *
+ * Taking the better of two random choices keeps the returned key close to
+ * the true minimum: the expected rank error is O(c*p), independent of the
+ * number of elements.
+ *
+ * Key Concepts:
+ * - Each heap is a generic_heap.cc Heap<T> (a min-heap) behind its own mutex
+ * - try_lock + retry on another heap: threads never wait for each other
+ * - Each heap publishes its top in an atomic, so choosing costs no lock
+ * - Each heap sits on its own cache lines (alignas(64)) - no false sharing
+ * - Rank error = how many smaller keys were present when a key was popped
+ *
+ * Time Complexities:
+ * - push(): O(log(n / cp)) expected
+ * - pop():  O(log(n / cp)) expected
+ *
+ * Space Complexity: O(n + cp)
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+using namespace std;
+
+/**
+ * @class Heap
+ * @brief Compact copy of generic_heap.cc's Heap<T, Compare>
+ * @tparam Compare higher_priority(a, b): true if a should be closer to the root
+ */
+template <typename T, typename Compare = less<T>>
+class Heap {
+  vector<T> arr_;     // Underlying array storing heap elements
+  Compare higher_;    // Priority rule (usually an empty functor)
+
+  static size_t parent(size_t i) { return (i - 1) / 2; }
+
+  void sift_up(size_t i) {
+    while (i != 0 && higher_(arr_[i], arr_[parent(i)])) {
+      swap(arr_[i], arr_[parent(i)]);
+      i = parent(i);
+    }
+  }
+
+  void sift_down(size_t i) {   // Hole technique
+    size_t n = arr_.size();
+    T elem = move(arr_[i]);
+    while (true) {
+      size_t best = 2 * i + 1;
+      if (best >= n) break;
+      if (best + 1 < n && higher_(arr_[best + 1], arr_[best])) ++best;
+      if (!higher_(arr_[best], elem)) break;
+      arr_[i] = move(arr_[best]);
+      i = best;
+    }
+    arr_[i] = move(elem);
+  }
+
+  public:
+  size_t size() const { return arr_.size(); }
+  bool empty() const { return arr_.empty(); }
+
+  const T& top() const {
+    if (arr_.empty()) throw out_of_range("top() on empty heap");
+    return arr_[0];
+  }
+
+  void push(T elem) { arr_.push_back(move(elem)); sift_up(arr_.size() - 1); }
+
+  T pop() {
+    if (arr_.empty()) throw out_of_range("pop() on empty heap");
+    T elem = move(arr_[0]);
+    if (arr_.size() > 1) arr_[0] = move(arr_.back());
+    arr_.pop_back();
+    if (!arr_.empty()) sift_down(0);
+    return elem;
+  }
+};
+
+/**
+ * @class MultiQueue
+ * @brief Relaxed min-priority queue over c*p try-locked binary heaps
+ * @tparam T Key type (integral; numeric_limits<T>::max() marks "empty")
+ */
+template <typename T>
+class MultiQueue {
+  static_assert(is_integral_v<T>, "cached tops are stored in atomic<T>");
+  static constexpr T kEmpty = numeric_limits<T>::max();
+
+  /**
+   * @struct Queue
+   * @brief One lock-protected min-heap and its published top
+   */
+  struct alignas(64) Queue {
+    mutex lock;
+    Heap<T> heap;               // Min-heap (less<T>: smaller is higher)
+    atomic<T> top{kEmpty};      // heap.front(), or kEmpty
+  };
+
+  vector<Queue> queues_;
+
+  static size_t pick(size_t n) {
+    thread_local mt19937 rng(random_device{}());
+    return rng() % n;
+  }
+
+  public:
+  /**
+   * @param threads Expected number of threads p
+   * @param c       Heaps per thread (default: 2)
+   */
+  explicit MultiQueue(size_t threads, size_t c = 2) : queues_(max<size_t>(2, c * threads)) {}
+
+  size_t queues() const { return queues_.size(); }
+
+  /**
+   * @brief Inserts key into a random unlocked heap
+   * @param key Any value except numeric_limits<T>::max()
+   * @throws std::invalid_argument for numeric_limits<T>::max(), which marks
+   *         an empty heap and could never be popped
+   */
+  void push(T key) {
+    if (key == kEmpty) throw invalid_argument("MultiQueue: key reserved as empty marker");
+    while (true) {
+      Queue& q = queues_[pick(queues_.size())];
+      if (!q.lock.try_lock()) continue;
+      q.heap.push(key);
+      q.top.store(q.heap.top(), memory_order_relaxed);
+      q.lock.unlock();
+      return;
+    }
+  }
+
+  /**
+   * @brief Removes one of the smallest keys
+   * @param on_pop Called with the key while the heap's lock is still held
+   *               (used to order pops for rank-error measurement)
+   * @return The key, or nullopt if every heap appears empty
+   *
+   * Two random heaps are compared by their cached tops; the better one is
+   * popped if its lock is free and it is still non-empty, otherwise retry.
+   */
+  template <typename F>
+  optional<T> pop(F&& on_pop) {
+    size_t failures = 0;
+    while (true) {
+      Queue& a = queues_[pick(queues_.size())];
+      Queue& b = queues_[pick(queues_.size())];
+      Queue& q = a.top.load(memory_order_relaxed) <= b.top.load(memory_order_relaxed) ? a : b;
+      if (q.top.load(memory_order_relaxed) == kEmpty) {
+        // Both samples empty: give up only after a full scan finds nothing
+        if (++failures < queues_.size()) continue;
+        bool any = false;
+        for (Queue& s : queues_) any = any || s.top.load(memory_order_relaxed) != kEmpty;
+        if (!any) return nullopt;
+        failures = 0;
+        continue;
+      }
+      if (!q.lock.try_lock()) continue;
+      if (!q.heap.empty()) {
+        T key = q.heap.pop();
+        on_pop(key);
+        q.top.store(q.heap.empty() ? kEmpty : q.heap.top(), memory_order_relaxed);
+        q.lock.unlock();
+        return key;
+      }
+      q.lock.unlock();
+      failures = 0;
+    }
+  }
+
+  optional<T> pop() { return pop([](T) {}); }
+};
+
+/*============================================================================
+ * MAIN FUNCTION - Test/Demo Section
+ *============================================================================*/
+
+/**
+ * @class Fenwick
+ * @brief Prefix counts of popped keys, for replaying pops in order
+ */
+class Fenwick {
+  vector<int> tree_;
+
+  public:
+  explicit Fenwick(size_t n) : tree_(n + 1) {}
+  void add(size_t i) { for (++i; i < tree_.size(); i += i & -i) ++tree_[i]; }
+  int prefix(size_t i) const {   // Count of keys < i
+    int s = 0;
+    for (; i > 0; i -= i & -i) s += tree_[i];
+    return s;
+  }
+};
+
+using Clock = chrono::steady_clock;
+
+/**
+ * @brief Runs one benchmark round with p threads
+ *
+ * Throughput: each thread performs ops/p rounds of pop + push(key + delta).
+ * Rank error: keys 0..n-1 are pushed, then all threads pop them, tagging
+ * each pop with a global ticket taken under the heap's lock. Replaying
+ * pops in ticket order, the rank of key k is k minus the smaller keys
+ * already popped.
+ */
+void bench(size_t p, size_t n, size_t ops) {
+  MultiQueue<uint64_t> mq(p);
+  for (uint64_t i = 0; i < n; ++i) mq.push(i * 16);
+
+  vector<thread> workers;
+  auto t0 = Clock::now();
+  for (size_t t = 0; t < p; ++t) {
+    workers.emplace_back([&mq, ops, p, t] {
+      mt19937 rng(static_cast<unsigned>(t));
+      for (size_t i = 0; i < ops / p; ++i) {
+        auto key = mq.pop();
+        mq.push((key ? *key : 0) + rng() % 1024);
+      }
+    });
+  }
+  for (auto& w : workers) w.join();
+  double sec = chrono::duration<double>(Clock::now() - t0).count();
+
+  MultiQueue<uint64_t> rq(p);
+  vector<uint64_t> keys(n);
+  for (uint64_t i = 0; i < n; ++i) keys[i] = i;
+  shuffle(keys.begin(), keys.end(), mt19937(19));
+  for (uint64_t k : keys) rq.push(k);
+  vector<uint64_t> order(n);   // order[ticket] = key
+  atomic<size_t> ticket{0};
+  auto record = [&](uint64_t key) { order[ticket.fetch_add(1)] = key; };
+  workers.clear();
+  for (size_t t = 0; t < p; ++t) {
+    workers.emplace_back([&] {
+      while (rq.pop(record)) {}
+    });
+  }
+  for (auto& w : workers) w.join();
+
+  Fenwick popped(n);
+  double sum = 0;
+  uint64_t worst = 0;
+  for (uint64_t k : order) {
+    uint64_t rank = k - popped.prefix(k);
+    sum += rank;
+    worst = max(worst, rank);
+    popped.add(k);
+  }
+  cout << "  " << p << " threads (" << mq.queues() << " heaps): "
+       << ops / sec / 1e6 << " Mops/s, rank error mean " << sum / n
+       << " max " << worst << "\n";
+}
+
+int main(int argc, char* argv[]) {
+  // Example 1: Single thread - every key comes back, nearly in order
+  MultiQueue<int> q(1);
+  for (int x : {5, 1, 4, 2, 3}) q.push(x);
+  while (auto x = q.pop()) cout << *x << " ";
+  cout << "\n";   // 1..5, possibly slightly out of order
+
+  // Example 2: Scalability from 1 to max_threads (default 64)
+  size_t max_threads = argc > 1 ? atoi(argv[1]) : 64;
+  size_t n = argc > 2 ? atoi(argv[2]) : 100000;
+  size_t ops = argc > 3 ? atoi(argv[3]) : 400000;
+  cout << "hardware threads: " << thread::hardware_concurrency() << "\n";
+  for (size_t p = 1; p <= max_threads; p *= 2) bench(p, n, ops);
+  return 0;
+}
+
+/*============================================================================
+ * NOTES
+ *============================================================================
+ *
+ * Why two choices?
+ * - Popping from one random heap returns the minimum of ~n/(cp) random
+ *   keys: rank error grows with the number of heaps and is unbounded in
+ *   the tail. Comparing two tops and taking the smaller one keeps the tops
+ *   of all heaps balanced, which bounds the expected rank error by O(cp).
+ *
+ * Why relaxed atomics for the tops?
+ * - They are only hints for choosing a heap. The heap itself is read under
+ *   its lock, so a stale top can cost a slightly worse choice, never a
+ *   wrong result.
+ *
+ * Oversubscription:
+ * - With more threads than cores, a thread can be preempted while holding
+ *   a heap's lock. Its keys are hidden for a whole time slice while the
+ *   other threads keep popping, so the measured rank error then reflects
+ *   the scheduler (thousands) rather than the O(cp) of a parallel run.
+ *   Compare rows only up to the printed hardware thread count.
+ *
+ * Why c = 2?
+ * - With c*p > p heaps, a thread almost always finds an unlocked heap on
+ *   the first try_lock. Larger c lowers contention but raises rank error.
+ *
+ *============================================================================*/
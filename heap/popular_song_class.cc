@@ -17,20 +17,23 @@
  * - Invariant: |max_pq| == |min_pq| or |max_pq| == |min_pq| + 1
  * - Median = max_pq.top() if odd count, else average of both tops
  * 
+ * Titles are interned (string_interner.h): each title is stored once in
+ * an arena and play counts live in a vector indexed by its 32-bit ID.
+ * 
  * Time Complexities:
  * - register_plays(): O(log n) - heap insertions and rebalancing
  * - is_popular():     O(1) - just compare against stored median
  * 
- * Space Complexity: O(n) - storing all play counts in heaps + map
+ * Space Complexity: O(n) - storing all play counts in heaps + interned titles
  */
 
 #include <algorithm>
 #include <functional>
 #include <iostream>
 #include <string>
-#include <unordered_map>
 #include <queue>
 #include <vector>
+#include "string_interner.h"
 using namespace std;
 
 /**
@@ -45,7 +48,8 @@ using namespace std;
  * - Right heap (min-heap): stores larger half of values
  */
 class PopularSongs {
-  unordered_map<string,int> umap;   // Maps song title -> play count
+  StringInterner titles_;           // Song title <-> dense ID
+  vector<int> plays_;                // Play count by title ID
   priority_queue<int> max_pq;        // Max-heap: smaller half (left side)
   priority_queue<int,vector<int>,greater<int>> min_pq;  // Min-heap: larger half (right side)
   
@@ -56,7 +60,7 @@ class PopularSongs {
    * @param plays Number of times the song was played
    * 
    * Algorithm:
-   * 1. Store (title, plays) in hash map for O(1) lookup
+   * 1. Intern title and store plays at its ID for O(1) lookup
    * 2. Add plays to max_pq (left heap)
    * 3. Balance: move max_pq's top to min_pq
    * 4. Rebalance if min_pq grows too large
@@ -98,7 +102,9 @@ class PopularSongs {
  */
 //O(logn)
 void PopularSongs::register_plays(const string& title, int plays) {
-  umap[title] = plays;
+  StringInterner::Id id = titles_.intern(title);
+  if(id>=plays_.size()) plays_.resize(id+1);
+  plays_[id] = plays;
   max_pq.push(plays);
   min_pq.push(max_pq.top());max_pq.pop();
   if(max_pq.size()<min_pq.size()) {
@@ -119,8 +125,9 @@ void PopularSongs::register_plays(const string& title, int plays) {
  */
 //O(1)
 bool PopularSongs::is_popular(const string& title) {
-  if(!umap.count(title)) return false;
-  int playCount = umap[title];
+  StringInterner::Id id = titles_.find(title);
+  if(id==StringInterner::kNone) return false;
+  int playCount = plays_[id];
   int median = (max_pq.size()>min_pq.size())?max_pq.top():(max_pq.top() + min_pq.top())/2;
   return median<playCount;
 }
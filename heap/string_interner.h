@@ -0,0 +1,130 @@
+/**
+ * @file string_interner.h
+ * @brief Title interning: dense 32-bit IDs for strings stored in an arena
+ *
+ * The song heaps (top_songs_class_with_updates.cc, popular_song_class.cc,
+ * make_playlist.cc) key their heaps and maps by title. Storing the title
+ * itself means every push, pop and comparison copies or compares a heap-
+ * allocated string. Interning stores each distinct string once and hands
+ * out IDs 0, 1, 2, ... so the hot path works on integers and plain vectors
+ * indexed by ID; strings are materialized only at the API boundary.
+ *
+ *   intern("Hey Queue")  -> 0      arena: [Hey Queue|Dirty Data|...]
+ *   intern("Dirty Data") -> 1      views_: 0 -> "Hey Queue", 1 -> ...
+ *   intern("Hey Queue")  -> 0      (already present: no copy)
+ *
+ * Key Concepts:
+ * - Characters live in 64 KB arena chunks that never move, so the
+ *   string_views handed out stay valid for the interner's lifetime
+ * - The hash map is keyed by those views: one copy of each string in total
+ *
+ * Time Complexities:
+ * - intern(), find(): O(length) expected (one hash)
+ * - view():           O(1)
+ *
+ * Space Complexity: O(total characters + distinct strings)
+ */
+
+#ifndef HEAP_STRING_INTERNER_H
+#define HEAP_STRING_INTERNER_H
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @class StringInterner
+ * @brief Maps strings to dense IDs and back; IDs are never reused
+ */
+class StringInterner {
+  public:
+  using Id = std::uint32_t;
+  static constexpr Id kNone = UINT32_MAX;     // find() result for "absent"
+
+  private:
+  static constexpr size_t kChunk = 64 * 1024;
+
+  std::vector<std::unique_ptr<char[]>> chunks_;   // Arena, never reallocated
+  char* cur_ = nullptr;                           // Free space in current chunk
+  size_t left_ = 0;                               // Bytes left at cur_
+  std::vector<std::string_view> views_;           // Id -> string
+  std::unordered_map<std::string_view, Id> ids_;  // String -> Id
+
+  /**
+   * @brief Copies s into the arena; strings longer than a chunk get their own
+   */
+  std::string_view store(std::string_view s) {
+    char* p;
+    if (s.size() > kChunk) {
+      chunks_.push_back(std::make_unique<char[]>(s.size()));
+      p = chunks_.back().get();
+    } else {
+      if (cur_ == nullptr || left_ < s.size()) {
+        chunks_.push_back(std::make_unique<char[]>(kChunk));
+        cur_ = chunks_.back().get();
+        left_ = kChunk;
+      }
+      p = cur_;
+      cur_ += s.size();
+      left_ -= s.size();
+    }
+    std::memcpy(p, s.data(), s.size());
+    return {p, s.size()};
+  }
+
+  public:
+  StringInterner() = default;
+  StringInterner(const StringInterner&) = delete;   // Views point into arena
+  StringInterner& operator=(const StringInterner&) = delete;
+
+  /**
+   * @brief Returns the ID of s, adding it if it is new
+   * @throws std::length_error if all 2^32 - 1 IDs are in use
+   */
+  Id intern(std::string_view s) {
+    auto found = ids_.find(s);
+    if (found != ids_.end()) return found->second;
+    if (views_.size() == kNone) throw std::length_error("StringInterner: out of IDs");
+    Id id = static_cast<Id>(views_.size());
+    std::string_view stored = store(s);
+    views_.push_back(stored);
+    ids_.emplace(stored, id);
+    return id;
+  }
+
+  /**
+   * @brief Returns the ID of s, or kNone if it was never interned
+   */
+  Id find(std::string_view s) const {
+    auto found = ids_.find(s);
+    return found == ids_.end() ? kNone : found->second;
+  }
+
+  /**
+   * @brief The string for id, valid for the interner's lifetime
+   * @throws std::out_of_range if id was not handed out
+   */
+  std::string_view view(Id id) const {
+    if (id >= views_.size()) throw std::out_of_range("StringInterner: unknown id");
+    return views_[id];
+  }
+
+  /**
+   * @brief Number of distinct strings = one past the largest ID
+   */
+  size_t size() const { return views_.size(); }
+
+  /**
+   * @brief Pre-sizes the ID table and hash map for n strings
+   */
+  void reserve(size_t n) {
+    views_.reserve(n);
+    ids_.reserve(n);
+  }
+};
+
+#endif  // HEAP_STRING_INTERNER_H
@@ -25,8 +25,15 @@
  *   - Each of k iterations: one pop O(log m) + one push O(log m)
  * 
  * Space Complexity: O(m) - heap stores exactly one entry per prime
+ * 
+ * Optional radix heap:
+ * - Every pushed power (power * base) is larger than the power just popped,
+ *   so the keys are monotone and a radix heap (see radix_heap.cc) can
+ *   replace the comparison heap: O(1) push, O(log C) amortized pop.
+ * - sum_first_k(primes, k, true) selects it.
  */
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <vector>
@@ -35,32 +42,67 @@ using namespace std;
 
 const long long MOD = 1e9 + 7;
 
+/**
+ * @class RadixHeap
+ * @brief Monotone min-heap with the priority_queue interface used below
+ * 
+ * Compact copy of radix_heap.cc: a key lives in the bucket given by the
+ * bit width of (key ^ last popped key). Keys must be >= the last key popped.
+ */
+class RadixHeap {
+  vector<pair<long long, int>> buckets_[65];
+  unsigned long long last_ = 0;
+  size_t size_ = 0;
+
+  int bucket_of(long long key) const {
+    unsigned long long x = static_cast<unsigned long long>(key) ^ last_;
+    return x == 0 ? 0 : 64 - __builtin_clzll(x);
+  }
+
+  public:
+  bool empty() const { return size_ == 0; }
+
+  void push(pair<long long, int> e) {
+    buckets_[bucket_of(e.first)].push_back(e);
+    ++size_;
+  }
+
+  /**
+   * Refills bucket 0 from the first non-empty bucket: its minimum becomes
+   * the new last key and every entry moves to a lower bucket.
+   */
+  const pair<long long, int>& top() {
+    if (buckets_[0].empty()) {
+      int b = 1;
+      while (buckets_[b].empty()) ++b;
+      long long lo = buckets_[b][0].first;
+      for (auto& e : buckets_[b]) lo = min(lo, e.first);
+      last_ = static_cast<unsigned long long>(lo);
+      for (auto& e : buckets_[b]) buckets_[bucket_of(e.first)].push_back(e);
+      buckets_[b].clear();
+    }
+    return buckets_[0].back();
+  }
+
+  void pop() {
+    top();
+    buckets_[0].pop_back();
+    --size_;
+  }
+};
+
 /*============================================================================
  * FUNCTION IMPLEMENTATION
  *============================================================================*/
 
 /**
- * @brief Computes sum of first k prime powers
- * @param primes Vector of distinct prime numbers
- * @param k Number of prime powers to sum
- * @return Sum of first k prime powers, modulo 10^9+7
- * 
- * Heap Structure: {current_power, base_prime}
- * - Uses min-heap to always extract smallest power
- * - base_prime used to compute next power: current * base
+ * @brief K-way merge of the prime power sequences on any min-heap
+ * @param pq Empty min-heap of {current_power, base_prime}
  * 
- * Time Complexity: O(k log m)
+ * Works with priority_queue<..., greater<...>> and RadixHeap alike.
  */
-long long sum_first_k(vector<int>& primes, int k) {
-  // Edge case: k <= 0 means sum nothing
-  if (k <= 0) return 0;
-  
-  // Min-heap: {current_power, base_prime}
-  // Using long long to prevent overflow (primes^power can exceed int)
-  priority_queue<pair<long long, int>,
-                 vector<pair<long long, int>>,
-                 greater<pair<long long, int>>> pq;
-  
+template <typename PQ>
+long long sum_first_k_with(PQ& pq, vector<int>& primes, int k) {
   // Step 1: Initialize heap with p^1 for each prime
   for (auto& x : primes) {
     pq.push({x, x});
@@ -84,16 +126,46 @@ long long sum_first_k(vector<int>& primes, int k) {
     if (counter == k) return sum_primes;
     
     // Push next power of same prime (if within bounds)
-    // Limit to 10^18 to prevent overflow in multiplication
-    long long next_power = power * base;
-    if (next_power <= 1e18) {
-      pq.push({next_power, base});
+    // Limit to 10^18; test before multiplying so power * base cannot
+    // overflow into a negative (non-monotone) key
+    if (power <= static_cast<long long>(1e18) / base) {
+      pq.push({power * base, base});
     }
   }
   
   return sum_primes;
 }
 
+/**
+ * @brief Computes sum of first k prime powers
+ * @param primes Vector of distinct prime numbers
+ * @param k Number of prime powers to sum
+ * @param use_radix_heap Use the monotone RadixHeap instead of priority_queue
+ * @return Sum of first k prime powers, modulo 10^9+7
+ * 
+ * Heap Structure: {current_power, base_prime}
+ * - Uses min-heap to always extract smallest power
+ * - base_prime used to compute next power: current * base
+ * 
+ * Time Complexity: O(k log m), or O(k log C) amortized with the radix heap
+ */
+long long sum_first_k(vector<int>& primes, int k, bool use_radix_heap = false) {
+  // Edge case: k <= 0 means sum nothing
+  if (k <= 0) return 0;
+  
+  if (use_radix_heap) {
+    RadixHeap rh;
+    return sum_first_k_with(rh, primes, k);
+  }
+  
+  // Min-heap: {current_power, base_prime}
+  // Using long long to prevent overflow (primes^power can exceed int)
+  priority_queue<pair<long long, int>,
+                 vector<pair<long long, int>>,
+                 greater<pair<long long, int>>> pq;
+  return sum_first_k_with(pq, primes, k);
+}
+
 /*============================================================================
  * MAIN FUNCTION - Test/Demo Section
  *============================================================================*/
@@ -123,6 +195,14 @@ int main() {
   k = 7;
   cout << sum_first_k(primes, k) << "\n";  // Expected: 69
   
+  // Test 4: Same as Test 3 with the radix heap
+  cout << sum_first_k(primes, k, true) << "\n";  // Expected: 69
+  
+  // Test 5: Both heaps agree on a larger input
+  primes = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
+  k = 300;
+  cout << (sum_first_k(primes, k) == sum_first_k(primes, k, true)) << "\n";  // Expected: 1
+  
   return 0;
 }
 
@@ -14,7 +14,8 @@
  * Algorithm:
  * 1. Push new song (plays, title) into min-heap
  * 2. If heap size exceeds k, pop the minimum
- * 3. For top_k(), extract all elements from heap copy
+ * 3. For top_k(), return a sorted snapshot of the heap, rebuilt only
+ *    when register_plays() changed the heap since the last call
  * 
  * This is simpler than top_songs_class_with_updates.cc because:
  * - Each song is registered only once
@@ -23,16 +24,19 @@
  * 
  * Time Complexities:
  * - Constructor:       O(1)
- * - register_plays():  O(log k) - single heap operation
- * - top_k():           O(k log k) - extract k elements
+ * - register_plays():  O(log k) - single heap operation, O(1) if the
+ *                      song does not make the top k
+ * - top_k():           O(1) if nothing changed, O(k log k) to rebuild
  * 
  * Space Complexity: O(k) - only store k elements in heap
  */
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <queue>
 using namespace std;
 
 /**
@@ -46,12 +50,20 @@ using namespace std;
  * - Heap keeps the k largest elements
  * - Min-heap lets us quickly identify and remove the smallest
  *   among our k candidates when a larger element arrives
+ * 
+ * The heap is a plain vector kept in heap order with push_heap/pop_heap
+ * (instead of priority_queue) so top_k() can read its entries in place.
  */
 class TopSongs {
   int k_;    // Number of top songs to track
   
-  // Min-heap: (plays, title) - smallest plays at top
-  priority_queue<pair<int,string>,vector<pair<int,string>>, greater<pair<int,string>>> pq;
+  // Min-heap: (plays, title) - smallest plays at top (greater<> ordering)
+  vector<pair<int,string>> heap_;
+  
+  // Titles of heap_ sorted by plays (most played first), valid if !dirty_
+  vector<string_view> snapshot_;
+  vector<const pair<int,string>*> order_;   // Scratch for rebuilding
+  bool dirty_ = false;                      // heap_ changed since snapshot_
   
   public:
   /**
@@ -68,21 +80,24 @@ class TopSongs {
    * @param count Number of plays
    * 
    * Maintains heap size at k by removing minimum when exceeded.
+   * A song whose (plays, title) pair is not above the current minimum of
+   * a full heap cannot enter the top k and leaves the heap (and snapshot)
+   * untouched. With k <= 0 every song is rejected.
    * 
-   * Time Complexity: O(log k)
+   * Time Complexity: O(log k), O(1) when the song is rejected
    */
   void register_plays(const string&,int); // O(logk)
   
   /**
    * @brief Returns titles of the k most played songs
-   * @return Vector of up to k song titles with highest play counts
+   * @return Up to k titles, most played first, as views into the heap
    * 
-   * Creates a copy of heap to preserve original for future calls.
-   * Elements are returned in ascending order of plays (min first).
+   * No strings are copied. The views stay valid until the next
+   * register_plays() call; copy them if they must outlive it.
    * 
-   * Time Complexity: O(k + k log k) = O(k log k)
+   * Time Complexity: O(1) if unchanged since the last call, else O(k log k)
    */
-  vector<string> top_k(); // O(k+klogk)
+  const vector<string_view>& top_k();
 };
 
 /*============================================================================
@@ -92,7 +107,7 @@ class TopSongs {
 /**
  * Constructor: Initialize k and empty heap
  */
-TopSongs::TopSongs(int k): k_{k},pq{} {}
+TopSongs::TopSongs(int k): k_{k} {}
 
 /**
  * register_plays() - Add a new song to tracking
@@ -112,31 +127,41 @@ TopSongs::TopSongs(int k): k_{k},pq{} {}
  * - Push 150 -> heap: [50, 100, 150, 200] -> pop 50 -> [100, 150, 200]
  */
 void TopSongs::register_plays(const string& title,int count) {
-  pq.push({count,title});
-  if(pq.size()>static_cast<size_t>(k_)) pq.pop();  // Remove smallest
+  if(k_<=0) return;                          // Nothing is ever tracked
+  auto cmp = greater<pair<int,string>>();
+  if(heap_.size()<static_cast<size_t>(k_)) {
+    heap_.push_back({count,title});
+    push_heap(heap_.begin(),heap_.end(),cmp);
+  } else {
+    // Not in the top k: no change. Compares the whole (plays, title) pair,
+    // as pushing then popping the minimum would, without copying title
+    const auto& [minCount,minTitle] = heap_.front();
+    if(count<minCount || (count==minCount && title<=minTitle)) return;
+    pop_heap(heap_.begin(),heap_.end(),cmp); // Smallest moves to the back
+    heap_.back() = {count,title};            // Replace it in place
+    push_heap(heap_.begin(),heap_.end(),cmp);
+  }
+  dirty_ = true;
 }
 
 /**
- * top_k() - Extract top k songs
- * 
- * Creates a temporary copy of the heap to preserve state.
- * Extracts elements in order (smallest first due to min-heap).
+ * top_k() - Return the cached snapshot, rebuilding it if dirty
  * 
- * Note: Elements are returned in ascending order of plays,
- * but the problem allows any order.
+ * Rebuild: sort pointers to the heap entries by plays (descending) and
+ * take a string_view of each title. Only pointers are sorted and no
+ * string is copied. Calls between two register_plays() return the same
+ * vector by reference.
  */
-vector<string> TopSongs::top_k() {
-  int temp = k_;
-  
-  // Copy heap to preserve original for future top_k() calls
-  priority_queue<pair<int,string>,vector<pair<int,string>>, greater<pair<int,string>>> pq_temp = pq;
-  
-  vector<string> res;
-  while(!pq_temp.empty() && temp--) {
-    res.push_back(pq_temp.top().second);
-    pq_temp.pop();
-  }
-  return res;
+const vector<string_view>& TopSongs::top_k() {
+  if(!dirty_) return snapshot_;
+  order_.clear();
+  for(auto& entry : heap_) order_.push_back(&entry);
+  sort(order_.begin(),order_.end(),
+       [](const pair<int,string>* a,const pair<int,string>* b) { return a->first>b->first; });
+  snapshot_.clear();
+  for(auto* entry : order_) snapshot_.push_back(entry->second);
+  dirty_ = false;
+  return snapshot_;
 }
 
 /*============================================================================
@@ -152,7 +177,7 @@ int main() {
   s.register_plays("Coding In The Deep", 146);
   
   // With only 2 songs, returns both
-  for(auto&title: s.top_k()) cout<<title<<"\n";  // Returns ["Coding In The Deep", "Boolean Rhapsody"]
+  for(auto&title: s.top_k()) cout<<title<<"\n";  // Returns ["Boolean Rhapsody", "Coding In The Deep"]
   cout<<"----------------\n";
   
   // Register more songs
@@ -164,6 +189,12 @@ int main() {
   // Top 3: 291, 274, 223 plays
   for(auto& title: s.top_k()) cout<<title<<"\n"; 
   cout<<"----------------\n";
+  
+  // 100 plays is below the current minimum (223): heap and snapshot are unchanged,
+  // so this top_k() returns the cached vector without rebuilding
+  s.register_plays("Stack Overflow Anthem", 100);
+  const vector<string_view>& same = s.top_k();
+  cout<<same.size()<<" "<<same.front()<<"\n";    // 3 All About That Base Case
   return 0;
 }
 
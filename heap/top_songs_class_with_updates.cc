@@ -9,30 +9,46 @@
  * Key Concepts:
  * - Cumulative updates: Multiple registrations add to total play count
  * - Lazy deletion: Old entries remain in heap but are invalidated
- * - Hash map validation: Check if heap entry matches current play count
+ * - Validation: Check if heap entry matches current play count
+ * - Title interning: heap entries and counts use 32-bit title IDs
  * 
  * Challenge with Updates:
  * - Standard heap doesn't support efficient decrease/increase key
  * - Solution: Push new entry with updated count, validate during extraction
  * 
  * Algorithm (Lazy Deletion):
- * 1. On register_plays: Update map with new total, push new heap entry
- * 2. On top_k: Pop entries, skip stale ones (map value != heap value)
+ * 1. On register_plays: Update the song's total, push new heap entry
+ * 2. On top_k: Pop entries, skip stale ones (total != heap value)
  * 3. Re-push valid entries to maintain heap state
  * 
+ * Title interning (string_interner.h):
+ * - Each title is stored once in an arena and mapped to a dense ID; the
+ *   heap holds (plays, ID) pairs and totals live in a vector indexed by
+ *   ID, so pushes, pops and comparisons never touch a string.
+ * - Titles are materialized only when top_k() returns them.
+ * 
+ * Compaction:
+ * - Every update of an existing song leaves one stale entry behind, so
+ *   the heap grows with the number of updates, not songs.
+ * - The class counts stale entries; when they exceed a configurable
+ *   fraction of the heap, the heap is rebuilt from the totals in O(n)
+ *   (Floyd's construction via the priority_queue range constructor).
+ * 
  * Time Complexities:
- * - register_plays(): O(log n) - single heap push
+ * - register_plays(): O(log n) - single heap push,
+ *                     plus amortized O(1) for compaction
  * - top_k():          O(m log n) where m is stale entries encountered
  *                     Amortized O(k log n) over many calls
  * 
- * Space Complexity: O(n) - map + heap (heap may have stale entries)
+ * Space Complexity: O(n) - titles + totals + heap; with compaction the heap holds at
+ * most n / (1 - max_stale_ratio) entries for n songs
  */
 
 #include <iostream>
 #include <string>
 #include <vector>
 #include <queue>
-#include <unordered_map>
+#include "string_interner.h"
 using namespace std;
 
 /**
@@ -42,19 +58,34 @@ using namespace std;
  * Features:
  * - Same song can be registered multiple times (plays accumulate)
  * - Uses max-heap with lazy deletion for efficient updates
- * - Hash map stores authoritative play counts
+ * - Totals indexed by title ID are the authoritative play counts
  */
 class TopSongs {
+  using Entry = pair<int,StringInterner::Id>;   // (plays, title ID)
+  
   int k_;                            // Number of top songs to track
-  priority_queue<pair<int,string>> pq;  // Max-heap: (plays, title)
-  unordered_map<string,int> umap;    // Authoritative play counts
+  priority_queue<Entry> pq;          // Max-heap: (plays, title ID)
+  StringInterner titles_;            // Title <-> dense ID
+  vector<int> plays_;                // Authoritative play counts by ID
+  double max_stale_ratio_;           // Rebuild when stale > ratio * heap size
+  size_t stale_ = 0;                 // Heap entries that no longer match plays_
+  size_t rebuilds_ = 0;              // Number of compactions so far
+  
+  /**
+   * @brief Rebuilds the heap from plays_ if stale entries exceed the threshold
+   * 
+   * Time Complexity: O(n) when it rebuilds, O(1) otherwise
+   */
+  void compact_if_stale();
   
   public:
   /**
    * @brief Constructor - initializes with k value
    * @param k Number of top songs to return
+   * @param max_stale_ratio Fraction of stale heap entries that triggers a
+   *        rebuild (default: 0.5, i.e. the heap is at most 2x the songs)
    */
-  TopSongs(int k);
+  TopSongs(int k, double max_stale_ratio = 0.5);
   
   /**
    * @brief Registers play count for a song (cumulative)
@@ -62,9 +93,10 @@ class TopSongs {
    * @param count Number of new plays to add
    * 
    * If song was previously registered, count is ADDED to existing total.
-   * Pushes new entry to heap (old entries become stale but remain).
+   * Pushes new entry to heap (old entries become stale but remain
+   * until top_k() drops them or the heap is compacted).
    * 
-   * Time Complexity: O(log n)
+   * Time Complexity: O(log n) amortized
    */
   void register_plays(const string&,int);
   
@@ -72,12 +104,27 @@ class TopSongs {
    * @brief Returns titles of the k most played songs
    * @return Vector of up to k song titles with highest play counts
    * 
-   * Uses lazy deletion: validates heap entries against map.
+   * Uses lazy deletion: validates heap entries against the totals.
    * Re-pushes valid entries to maintain heap state for future calls.
    * 
    * Time Complexity: O(m log n) where m is stale entries + k
    */
   vector<string> top_k();
+  
+  /**
+   * @brief Number of entries in the heap (live + stale)
+   */
+  size_t heap_size() const { return pq.size(); }
+  
+  /**
+   * @brief Number of stale entries in the heap
+   */
+  size_t stale_count() const { return stale_; }
+  
+  /**
+   * @brief Number of O(n) rebuilds performed so far
+   */
+  size_t rebuild_count() const { return rebuilds_; }
 };
 
 /*============================================================================
@@ -87,15 +134,16 @@ class TopSongs {
 /**
  * Constructor: Initialize k and empty containers
  */
-TopSongs::TopSongs(int k): k_{k},pq{} {}
+TopSongs::TopSongs(int k, double max_stale_ratio)
+    : k_{k},pq{},max_stale_ratio_{max_stale_ratio} {}
 
 /**
  * register_plays() - Add plays to a song's total
  * 
  * Algorithm:
- * 1. Calculate new total (existing + new count)
- * 2. Update map with new total
- * 3. Push new entry to max-heap
+ * 1. Intern the title (a new title gets the next ID and a 0 total)
+ * 2. Calculate and store new total (existing + new count)
+ * 3. Push new (total, ID) entry to max-heap
  * 
  * Note: Old heap entries for this song are NOT removed.
  * They become "stale" and are filtered out in top_k().
@@ -105,12 +153,37 @@ TopSongs::TopSongs(int k): k_{k},pq{} {}
  * - Lazy deletion is simpler and amortizes well
  */
 void TopSongs::register_plays(const string& title,int count) {
-  int newTotalPlays = count;
-  if (umap.count(title)) {
-    newTotalPlays += umap[title];  // Add to existing total
+  StringInterner::Id id = titles_.intern(title);
+  if (id < plays_.size()) {
+    ++stale_;                      // The previous entry is now stale
+  } else {
+    plays_.push_back(0);           // New title: IDs are dense
   }
-  umap[title] = newTotalPlays;
-  pq.push({newTotalPlays, title});  // Push updated entry
+  plays_[id] += count;             // Add to existing total
+  pq.push({plays_[id], id});       // Push updated entry
+  compact_if_stale();
+}
+
+/**
+ * compact_if_stale() - O(n) rebuild once stale entries pile up
+ * 
+ * Algorithm:
+ * 1. If stale_ <= max_stale_ratio_ * heap size, do nothing
+ * 2. Otherwise collect one (plays, ID) per song from plays_
+ * 3. Build a new heap from that vector with Floyd's O(n) construction
+ * 
+ * Amortized cost: a rebuild of n live entries happens only after at
+ * least ratio * heap size stale pushes, so it adds O(1) per update.
+ * Small heaps (< 64 entries) are never compacted.
+ */
+void TopSongs::compact_if_stale() {
+  if (pq.size() < 64 || stale_ <= max_stale_ratio_ * pq.size()) return;
+  vector<Entry> live;
+  live.reserve(plays_.size());
+  for (StringInterner::Id id = 0; id < plays_.size(); ++id) live.push_back({plays_[id], id});
+  pq = priority_queue<Entry>(less<Entry>(), move(live));
+  stale_ = 0;
+  ++rebuilds_;
 }
 
 /**
@@ -118,10 +191,11 @@ void TopSongs::register_plays(const string& title,int count) {
  * 
  * Algorithm:
  * 1. Pop entries from max-heap
- * 2. For each entry, check if it's "fresh" (heap count == map count)
+ * 2. For each entry, check if it's "fresh" (heap count == total)
  * 3. If stale (counts don't match), skip it
  * 4. If fresh, add to result
  * 5. After collecting k songs, re-push them to maintain heap
+ * 6. Materialize the k titles from their IDs
  * 
  * Why re-push?
  * - We want subsequent top_k() calls to work correctly
@@ -130,25 +204,29 @@ void TopSongs::register_plays(const string& title,int count) {
  * Example of staleness:
  * - Register "Song A" with 100 plays -> heap has (100, "Song A")
  * - Register "Song A" with 50 plays -> heap has (150, "Song A") AND (100, "Song A")
- * - The (100, "Song A") entry is stale because map["Song A"] = 150
+ * - The (100, "Song A") entry is stale because the total is 150
+ * (entries hold the title's ID, shown here as the title)
  */
 vector<string> TopSongs::top_k() {
-  vector<string> res;
+  vector<StringInterner::Id> ids;
   
-  while (res.size() < static_cast<size_t>(k_) && !pq.empty()) {
-    auto [count, title] = pq.top();  // Structured binding (C++17)
+  while (ids.size() < static_cast<size_t>(k_) && !pq.empty()) {
+    auto [count, id] = pq.top();  // Structured binding (C++17)
     pq.pop();
     
     // Validate: is this entry current?
-    if (umap[title] == count) {
-      res.push_back(title);  // Fresh entry - include in result
+    if (plays_[id] == count) {
+      ids.push_back(id);     // Fresh entry - include in result
+    } else {
+      --stale_;              // Stale entry - dropped for good
     }
-    // Stale entry - skip (implicitly deleted)
   }
   
   // Re-push valid entries to maintain heap for future calls
-  for (const auto& title : res) {
-    pq.push({umap[title], title});
+  vector<string> res;
+  for (StringInterner::Id id : ids) {
+    pq.push({plays_[id], id});
+    res.emplace_back(titles_.view(id));   // Titles leave as strings only here
   }
   
   return res;
@@ -177,6 +255,14 @@ int main() {
   // Top 3: Boolean Rhapsody (293), All About That Base Case (291), 
   //        Oops! I Broke Prod Again (274)
   for(auto& title : s.top_k()) cout<<title<<"\n";
+  
+  // Update-heavy traffic: 100 songs, 100000 updates. Without compaction
+  // the heap would hold 100000 entries; with it, at most 2x the songs.
+  TopSongs busy = TopSongs(3);
+  for (int i = 0; i < 100000; ++i) busy.register_plays("song" + to_string(i % 100), 1 + i % 7);
+  cout<<"heap size "<<busy.heap_size()<<", stale "<<busy.stale_count()
+      <<", rebuilds "<<busy.rebuild_count()<<"\n";   // heap size <= 200
+  for(auto& title : busy.top_k()) cout<<title<<"\n";
   return 0;
 }
 